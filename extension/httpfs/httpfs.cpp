@@ -10,6 +10,7 @@
 #include "duckdb/logging/http_logger.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/operator_metrics.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 
@@ -300,6 +301,10 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRequest(FileHandle &handle, strin
 			    if (hfh.state) {
 				    hfh.state->total_bytes_received += data_length;
 			    }
+			    auto metrics = OperatorMetrics::Active();
+			    if (metrics) {
+				    metrics->bytes_read += data_length;
+			    }
 			    if (!hfh.cached_file_handle->GetCapacity()) {
 				    hfh.cached_file_handle->AllocateBuffer(data_length);
 				    hfh.length = data_length;
@@ -371,6 +376,10 @@ unique_ptr<ResponseWrapper> HTTPFileSystem::GetRangeRequest(FileHandle &handle,
 			    if (hfs.state) {
 				    hfs.state->total_bytes_received += data_length;
 			    }
+			    auto metrics = OperatorMetrics::Active();
+			    if (metrics) {
+				    metrics->bytes_read += data_length;
+			    }
 			    if (buffer_out != nullptr) {
 				    if (data_length + out_offset > buffer_out_len) {
 					    // As of v0.8.2-dev4424 we might end up here when very big files are served from servers
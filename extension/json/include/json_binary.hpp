@@ -0,0 +1,86 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_binary.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "json_common.hpp"
+
+namespace duckdb {
+
+//! Binary JSON (JSONB), a BLOB that stores a parsed JSON document. Values are encoded as a one-byte type followed by
+//! the payload. Arrays and objects have offset tables, so that elements can be accessed without decoding the values
+//! that precede them, and object keys are sorted, so that fields can be found with a binary search.
+//! Every nested value is a valid JSONB value by itself, so extracting a value does not require re-encoding it.
+//!
+//! Layout of the payloads (integers are little-endian):
+//!  - NULL/FALSE/TRUE: none
+//!  - UINT/SINT/REAL: 8 bytes
+//!  - STRING: uint32 length, the bytes of the string
+//!  - ARRAY: uint32 count, count x uint32 end offset of the element, the elements
+//!  - OBJECT: uint32 count, count x uint32 end offset of the key, count x uint32 end offset of the value, the keys,
+//!    the values (end offsets are relative to the start of the keys/values)
+enum class JSONBinaryType : uint8_t { NULL_VALUE, FALSE_VALUE, TRUE_VALUE, UINT, SINT, REAL, STRING, ARRAY, OBJECT };
+
+//! A value within a JSONB document
+struct JSONBinaryValue {
+public:
+	JSONBinaryValue() : ptr(nullptr), size(0) {
+	}
+	JSONBinaryValue(const_data_ptr_t ptr_p, uint32_t size_p) : ptr(ptr_p), size(size_p) {
+	}
+	explicit JSONBinaryValue(const string_t &input)
+	    : JSONBinaryValue(const_data_ptr_cast(input.GetData()), UnsafeNumericCast<uint32_t>(input.GetSize())) {
+	}
+
+	inline bool IsValid() const {
+		return ptr != nullptr;
+	}
+	inline JSONBinaryType GetType() const {
+		return static_cast<JSONBinaryType>(*ptr);
+	}
+	inline bool IsNull() const {
+		return GetType() == JSONBinaryType::NULL_VALUE;
+	}
+	inline string_t AsBinary() const {
+		return string_t(const_char_ptr_cast(ptr), size);
+	}
+	//! The string of a STRING value
+	string_t GetString() const;
+	//! The number of elements of an ARRAY value, or the number of fields of an OBJECT value
+	uint32_t GetCount() const;
+
+	//! Get an element of an ARRAY value, returns an invalid value if the index is out of range
+	JSONBinaryValue GetElement(idx_t index) const;
+	//! Get a field of an OBJECT value, returns an invalid value if there is no such field
+	JSONBinaryValue GetField(const char *key, idx_t key_len) const;
+	//! Get a value using a JSON pointer/path that was split by JSONCommon::SplitPath
+	JSONBinaryValue GetPath(const vector<JSONPathElement> &path) const;
+
+public:
+	const_data_ptr_t ptr;
+	uint32_t size;
+};
+
+struct JSONBinary {
+public:
+	static constexpr const char *TYPE_NAME = "JSONB";
+	//! The JSONB type, a BLOB with an alias
+	static LogicalType GetType();
+	static bool IsJSONBinaryType(const LogicalType &type);
+
+	//! Encode a yyjson value into a JSONB document, using the buffer as scratch space
+	static void Encode(yyjson_val *val, vector<data_t> &buffer);
+	//! Decode a JSONB document into a mutable yyjson value (strings are not copied)
+	static yyjson_mut_val *Decode(const JSONBinaryValue &val, yyjson_mut_doc *doc);
+	//! Decode a JSONB document and write it as JSON text
+	static string_t ToJSON(const JSONBinaryValue &val, yyjson_alc *alc);
+	//! Verify that a BLOB is a well-formed JSONB document
+	static bool Verify(const JSONBinaryValue &val);
+};
+
+} // namespace duckdb
@@ -85,6 +85,22 @@ template <typename T>
 using json_key_map_t = unordered_map<JSONKey, T, JSONKeyHash, JSONKeyEquality>;
 using json_key_set_t = unordered_set<JSONKey, JSONKeyHash, JSONKeyEquality>;
 
+//! An element of a JSON pointer/path, used to evaluate paths on values that are not yyjson values
+struct JSONPathElement {
+	enum class Type : uint8_t {
+		//! Object field ('$.key')
+		KEY,
+		//! Array index ('$[index]')
+		INDEX,
+		//! JSON pointer token ('/token'), either an object field or an array index
+		POINTER_TOKEN,
+	};
+	Type type;
+	string key;
+	idx_t index;
+	bool from_back;
+};
+
 //! Common JSON functionality for most JSON functions
 struct JSONCommon {
 public:
@@ -286,6 +302,8 @@ public:
 
 	//! Validate JSON Path ($.field[index]... syntax), returns true if there are wildcards in the path
 	static JSONPathType ValidatePath(const char *ptr, const idx_t &len, const bool binder);
+	//! Split a JSON pointer/path without wildcards into its elements
+	static void SplitPath(const char *ptr, const idx_t &len, vector<JSONPathElement> &elements);
 
 private:
 	//! Get JSON pointer (/field/index/... syntax)
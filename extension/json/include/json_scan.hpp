@@ -177,6 +177,8 @@ public:
 	//! Column names that we're actually reading (after projection pushdown)
 	vector<string> names;
 	vector<column_t> column_indices;
+	//! If only some of the columns are read, the top-level keys of the records that have to be parsed (points into names)
+	json_key_set_t projected_keys;
 
 	//! Buffer manager allocator
 	Allocator &allocator;
@@ -192,6 +194,8 @@ public:
 
 	//! Current number of threads active
 	idx_t system_threads;
+	//! The number of threads that can parse a stream in parallel (each thread holds its own buffers)
+	idx_t stream_threads;
 	//! Whether we enable parallel scans (only if less files than threads)
 	bool enable_parallel_scans;
 };
@@ -242,6 +246,7 @@ private:
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	bool ParseJSONProjected(const char *const json_start, const idx_t json_size);
 	void ThrowObjectSizeError(const idx_t object_size);
 
 	//! Must hold the lock
@@ -251,6 +256,8 @@ private:
 private:
 	//! Bind data
 	const JSONScanData &bind_data;
+	//! The top-level keys to parse, if not all of them are needed
+	optional_ptr<const json_key_set_t> projected_keys;
 	//! Thread-local allocator
 	JSONAllocator allocator;
 
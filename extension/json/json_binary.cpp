@@ -0,0 +1,501 @@
+#include "json_binary.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/function/cast/cast_function_set.hpp"
+#include "duckdb/function/cast/default_casts.hpp"
+#include "json_functions.hpp"
+
+namespace duckdb {
+
+static constexpr idx_t JSONB_COUNT_SIZE = sizeof(uint32_t);
+static constexpr idx_t JSONB_OFFSET_SIZE = sizeof(uint32_t);
+
+//===--------------------------------------------------------------------===//
+// Access
+//===--------------------------------------------------------------------===//
+static inline uint32_t LoadOffset(const_data_ptr_t offsets, idx_t i) {
+	return Load<uint32_t>(offsets + i * JSONB_OFFSET_SIZE);
+}
+
+//! The start (relative to the start of the region) and the size of the i-th entry of a region with end offsets
+static inline void GetEntry(const_data_ptr_t offsets, idx_t i, uint32_t &start, uint32_t &size) {
+	start = i == 0 ? 0 : LoadOffset(offsets, i - 1);
+	size = LoadOffset(offsets, i) - start;
+}
+
+string_t JSONBinaryValue::GetString() const {
+	D_ASSERT(GetType() == JSONBinaryType::STRING);
+	return string_t(const_char_ptr_cast(ptr + 1 + JSONB_COUNT_SIZE), Load<uint32_t>(ptr + 1));
+}
+
+uint32_t JSONBinaryValue::GetCount() const {
+	D_ASSERT(GetType() == JSONBinaryType::ARRAY || GetType() == JSONBinaryType::OBJECT);
+	return Load<uint32_t>(ptr + 1);
+}
+
+JSONBinaryValue JSONBinaryValue::GetElement(idx_t index) const {
+	D_ASSERT(GetType() == JSONBinaryType::ARRAY);
+	const auto count = GetCount();
+	if (index >= count) {
+		return JSONBinaryValue();
+	}
+	const auto offsets = ptr + 1 + JSONB_COUNT_SIZE;
+	const auto elements = offsets + count * JSONB_OFFSET_SIZE;
+	uint32_t start, element_size;
+	GetEntry(offsets, index, start, element_size);
+	return JSONBinaryValue(elements + start, element_size);
+}
+
+static inline int CompareKeys(const char *left, idx_t left_len, const char *right, idx_t right_len) {
+	const auto cmp = memcmp(left, right, MinValue(left_len, right_len));
+	if (cmp != 0) {
+		return cmp;
+	}
+	return left_len < right_len ? -1 : (left_len > right_len ? 1 : 0);
+}
+
+JSONBinaryValue JSONBinaryValue::GetField(const char *key, idx_t key_len) const {
+	D_ASSERT(GetType() == JSONBinaryType::OBJECT);
+	const auto count = GetCount();
+	const auto key_offsets = ptr + 1 + JSONB_COUNT_SIZE;
+	const auto value_offsets = key_offsets + count * JSONB_OFFSET_SIZE;
+	const auto keys = value_offsets + count * JSONB_OFFSET_SIZE;
+	const auto values = keys + (count == 0 ? 0 : LoadOffset(key_offsets, count - 1));
+
+	// Keys are sorted and unique: binary search
+	idx_t lower = 0;
+	idx_t upper = count;
+	while (lower < upper) {
+		const auto middle = lower + (upper - lower) / 2;
+		uint32_t start, size;
+		GetEntry(key_offsets, middle, start, size);
+		const auto cmp = CompareKeys(const_char_ptr_cast(keys + start), size, key, key_len);
+		if (cmp == 0) {
+			GetEntry(value_offsets, middle, start, size);
+			return JSONBinaryValue(values + start, size);
+		} else if (cmp < 0) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	return JSONBinaryValue();
+}
+
+JSONBinaryValue JSONBinaryValue::GetPath(const vector<JSONPathElement> &path) const {
+	auto val = *this;
+	for (auto &element : path) {
+		switch (val.GetType()) {
+		case JSONBinaryType::OBJECT:
+			if (element.type == JSONPathElement::Type::INDEX) {
+				return JSONBinaryValue();
+			}
+			val = val.GetField(element.key.c_str(), element.key.size());
+			break;
+		case JSONBinaryType::ARRAY: {
+			if (element.type == JSONPathElement::Type::KEY) {
+				return JSONBinaryValue();
+			}
+			auto index = element.index;
+			if (element.from_back && index != 0) {
+				index = val.GetCount() - index;
+			}
+			val = val.GetElement(index);
+			break;
+		}
+		default:
+			return JSONBinaryValue();
+		}
+		if (!val.IsValid()) {
+			break;
+		}
+	}
+	return val;
+}
+
+//===--------------------------------------------------------------------===//
+// Encoding
+//===--------------------------------------------------------------------===//
+static inline void AppendByte(vector<data_t> &buffer, data_t byte) {
+	buffer.push_back(byte);
+}
+
+template <class T>
+static inline void AppendValue(vector<data_t> &buffer, T value) {
+	const auto offset = buffer.size();
+	buffer.resize(offset + sizeof(T));
+	Store<T>(value, buffer.data() + offset);
+}
+
+//! Reserves space for count offsets, and returns the position of the first one
+static inline idx_t ReserveOffsets(vector<data_t> &buffer, idx_t count) {
+	const auto offset = buffer.size();
+	buffer.resize(offset + count * JSONB_OFFSET_SIZE);
+	return offset;
+}
+
+static inline void StoreOffset(vector<data_t> &buffer, idx_t offsets, idx_t i, idx_t value) {
+	if (value > NumericLimits<uint32_t>::Maximum()) {
+		throw InvalidInputException("JSON document is too large to be stored as %s", JSONBinary::TYPE_NAME);
+	}
+	Store<uint32_t>(UnsafeNumericCast<uint32_t>(value), buffer.data() + offsets + i * JSONB_OFFSET_SIZE);
+}
+
+struct JSONBinaryField {
+	const char *key;
+	uint32_t key_len;
+	yyjson_val *val;
+};
+
+static void EncodeInternal(yyjson_val *val, vector<data_t> &buffer) {
+	switch (yyjson_get_tag(val)) {
+	case YYJSON_TYPE_NULL | YYJSON_SUBTYPE_NONE:
+		AppendByte(buffer, data_t(JSONBinaryType::NULL_VALUE));
+		break;
+	case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_FALSE:
+		AppendByte(buffer, data_t(JSONBinaryType::FALSE_VALUE));
+		break;
+	case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_TRUE:
+		AppendByte(buffer, data_t(JSONBinaryType::TRUE_VALUE));
+		break;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT:
+		AppendByte(buffer, data_t(JSONBinaryType::UINT));
+		AppendValue<uint64_t>(buffer, unsafe_yyjson_get_uint(val));
+		break;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT:
+		AppendByte(buffer, data_t(JSONBinaryType::SINT));
+		AppendValue<int64_t>(buffer, unsafe_yyjson_get_sint(val));
+		break;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_REAL:
+		AppendByte(buffer, data_t(JSONBinaryType::REAL));
+		AppendValue<double>(buffer, unsafe_yyjson_get_real(val));
+		break;
+	case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NOESC:
+	case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE: {
+		const auto len = unsafe_yyjson_get_len(val);
+		AppendByte(buffer, data_t(JSONBinaryType::STRING));
+		AppendValue<uint32_t>(buffer, UnsafeNumericCast<uint32_t>(len));
+		const auto offset = buffer.size();
+		buffer.resize(offset + len);
+		memcpy(buffer.data() + offset, unsafe_yyjson_get_str(val), len);
+		break;
+	}
+	case YYJSON_TYPE_ARR | YYJSON_SUBTYPE_NONE: {
+		const auto count = unsafe_yyjson_get_len(val);
+		AppendByte(buffer, data_t(JSONBinaryType::ARRAY));
+		AppendValue<uint32_t>(buffer, UnsafeNumericCast<uint32_t>(count));
+		const auto offsets = ReserveOffsets(buffer, count);
+		const auto elements = buffer.size();
+		size_t idx, max;
+		yyjson_val *element;
+		yyjson_arr_foreach(val, idx, max, element) {
+			EncodeInternal(element, buffer);
+			StoreOffset(buffer, offsets, idx, buffer.size() - elements);
+		}
+		break;
+	}
+	case YYJSON_TYPE_OBJ | YYJSON_SUBTYPE_NONE: {
+		// Sort the fields by key. The sort is stable, so of duplicate keys we keep the first, like yyjson_obj_getn
+		vector<JSONBinaryField> fields;
+		fields.reserve(unsafe_yyjson_get_len(val));
+		size_t idx, max;
+		yyjson_val *key, *field_val;
+		yyjson_obj_foreach(val, idx, max, key, field_val) {
+			fields.push_back({unsafe_yyjson_get_str(key), UnsafeNumericCast<uint32_t>(unsafe_yyjson_get_len(key)),
+			                  field_val});
+		}
+		std::stable_sort(fields.begin(), fields.end(), [](const JSONBinaryField &a, const JSONBinaryField &b) {
+			return CompareKeys(a.key, a.key_len, b.key, b.key_len) < 0;
+		});
+		auto end = std::unique(fields.begin(), fields.end(), [](const JSONBinaryField &a, const JSONBinaryField &b) {
+			return CompareKeys(a.key, a.key_len, b.key, b.key_len) == 0;
+		});
+		fields.erase(end, fields.end());
+
+		const auto count = fields.size();
+		AppendByte(buffer, data_t(JSONBinaryType::OBJECT));
+		AppendValue<uint32_t>(buffer, UnsafeNumericCast<uint32_t>(count));
+		const auto key_offsets = ReserveOffsets(buffer, count);
+		const auto value_offsets = ReserveOffsets(buffer, count);
+		const auto keys = buffer.size();
+		for (idx_t i = 0; i < count; i++) {
+			auto &field = fields[i];
+			const auto offset = buffer.size();
+			buffer.resize(offset + field.key_len);
+			memcpy(buffer.data() + offset, field.key, field.key_len);
+			StoreOffset(buffer, key_offsets, i, buffer.size() - keys);
+		}
+		const auto values = buffer.size();
+		for (idx_t i = 0; i < count; i++) {
+			EncodeInternal(fields[i].val, buffer);
+			StoreOffset(buffer, value_offsets, i, buffer.size() - values);
+		}
+		break;
+	}
+	default:
+		throw InternalException("Unexpected yyjson tag in JSONBinary::Encode");
+	}
+}
+
+void JSONBinary::Encode(yyjson_val *val, vector<data_t> &buffer) {
+	buffer.clear();
+	EncodeInternal(val, buffer);
+}
+
+//===--------------------------------------------------------------------===//
+// Decoding
+//===--------------------------------------------------------------------===//
+yyjson_mut_val *JSONBinary::Decode(const JSONBinaryValue &val, yyjson_mut_doc *doc) {
+	switch (val.GetType()) {
+	case JSONBinaryType::NULL_VALUE:
+		return yyjson_mut_null(doc);
+	case JSONBinaryType::FALSE_VALUE:
+		return yyjson_mut_false(doc);
+	case JSONBinaryType::TRUE_VALUE:
+		return yyjson_mut_true(doc);
+	case JSONBinaryType::UINT:
+		return yyjson_mut_uint(doc, Load<uint64_t>(val.ptr + 1));
+	case JSONBinaryType::SINT:
+		return yyjson_mut_sint(doc, Load<int64_t>(val.ptr + 1));
+	case JSONBinaryType::REAL:
+		return yyjson_mut_real(doc, Load<double>(val.ptr + 1));
+	case JSONBinaryType::STRING:
+		// Point into the document rather than into a string_t, which holds short strings inline
+		return yyjson_mut_strn(doc, const_char_ptr_cast(val.ptr + 1 + JSONB_COUNT_SIZE), Load<uint32_t>(val.ptr + 1));
+	case JSONBinaryType::ARRAY: {
+		auto result = yyjson_mut_arr(doc);
+		const auto count = val.GetCount();
+		for (idx_t i = 0; i < count; i++) {
+			yyjson_mut_arr_append(result, Decode(val.GetElement(i), doc));
+		}
+		return result;
+	}
+	case JSONBinaryType::OBJECT: {
+		auto result = yyjson_mut_obj(doc);
+		const auto count = val.GetCount();
+		const auto key_offsets = val.ptr + 1 + JSONB_COUNT_SIZE;
+		const auto value_offsets = key_offsets + count * JSONB_OFFSET_SIZE;
+		const auto keys = value_offsets + count * JSONB_OFFSET_SIZE;
+		const auto values = keys + (count == 0 ? 0 : LoadOffset(key_offsets, count - 1));
+		for (idx_t i = 0; i < count; i++) {
+			uint32_t start, size;
+			GetEntry(key_offsets, i, start, size);
+			auto key = yyjson_mut_strn(doc, const_char_ptr_cast(keys + start), size);
+			GetEntry(value_offsets, i, start, size);
+			yyjson_mut_obj_add(result, key, Decode(JSONBinaryValue(values + start, size), doc));
+		}
+		return result;
+	}
+	default:
+		throw InternalException("Unexpected type in JSONBinary::Decode");
+	}
+}
+
+string_t JSONBinary::ToJSON(const JSONBinaryValue &val, yyjson_alc *alc) {
+	auto doc = JSONCommon::CreateDocument(alc);
+	return JSONCommon::WriteVal<yyjson_mut_val>(Decode(val, doc), alc);
+}
+
+//===--------------------------------------------------------------------===//
+// Verification
+//===--------------------------------------------------------------------===//
+//! Verifies that the end offsets of count entries are ascending and within the region
+static bool VerifyOffsets(const_data_ptr_t offsets, idx_t count, idx_t region_size) {
+	uint32_t previous = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto offset = LoadOffset(offsets, i);
+		if (offset < previous || offset > region_size) {
+			return false;
+		}
+		previous = offset;
+	}
+	return true;
+}
+
+static bool VerifyInternal(const JSONBinaryValue &val, idx_t depth) {
+	if (val.size == 0 || depth > 1000) {
+		return false;
+	}
+	switch (val.GetType()) {
+	case JSONBinaryType::NULL_VALUE:
+	case JSONBinaryType::FALSE_VALUE:
+	case JSONBinaryType::TRUE_VALUE:
+		return val.size == 1;
+	case JSONBinaryType::UINT:
+	case JSONBinaryType::SINT:
+	case JSONBinaryType::REAL:
+		return val.size == 1 + sizeof(uint64_t);
+	case JSONBinaryType::STRING:
+		return val.size >= 1 + JSONB_COUNT_SIZE && val.size == 1 + JSONB_COUNT_SIZE + Load<uint32_t>(val.ptr + 1);
+	case JSONBinaryType::ARRAY: {
+		if (val.size < 1 + JSONB_COUNT_SIZE) {
+			return false;
+		}
+		const idx_t count = val.GetCount();
+		const idx_t header_size = 1 + JSONB_COUNT_SIZE + count * JSONB_OFFSET_SIZE;
+		if (header_size > val.size) {
+			return false;
+		}
+		const auto offsets = val.ptr + 1 + JSONB_COUNT_SIZE;
+		const auto elements_size = val.size - header_size;
+		if (!VerifyOffsets(offsets, count, elements_size) ||
+		    (count == 0 ? 0 : LoadOffset(offsets, count - 1)) != elements_size) {
+			return false;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			if (!VerifyInternal(val.GetElement(i), depth + 1)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case JSONBinaryType::OBJECT: {
+		if (val.size < 1 + JSONB_COUNT_SIZE) {
+			return false;
+		}
+		const idx_t count = val.GetCount();
+		const idx_t header_size = 1 + JSONB_COUNT_SIZE + 2 * count * JSONB_OFFSET_SIZE;
+		if (header_size > val.size) {
+			return false;
+		}
+		const auto key_offsets = val.ptr + 1 + JSONB_COUNT_SIZE;
+		const auto value_offsets = key_offsets + count * JSONB_OFFSET_SIZE;
+		const auto keys = value_offsets + count * JSONB_OFFSET_SIZE;
+		if (!VerifyOffsets(key_offsets, count, val.size - header_size)) {
+			return false;
+		}
+		const idx_t keys_size = count == 0 ? 0 : LoadOffset(key_offsets, count - 1);
+		const auto values_size = val.size - header_size - keys_size;
+		if (!VerifyOffsets(value_offsets, count, values_size) ||
+		    (count == 0 ? 0 : LoadOffset(value_offsets, count - 1)) != values_size) {
+			return false;
+		}
+		for (idx_t i = 0; i < count; i++) {
+			uint32_t start, size;
+			GetEntry(key_offsets, i, start, size);
+			if (i != 0) {
+				// Keys must be sorted and unique
+				uint32_t prev_start, prev_size;
+				GetEntry(key_offsets, i - 1, prev_start, prev_size);
+				if (CompareKeys(const_char_ptr_cast(keys + prev_start), prev_size, const_char_ptr_cast(keys + start),
+				                size) >= 0) {
+					return false;
+				}
+			}
+			GetEntry(value_offsets, i, start, size);
+			if (!VerifyInternal(JSONBinaryValue(keys + keys_size + start, size), depth + 1)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool JSONBinary::Verify(const JSONBinaryValue &val) {
+	return VerifyInternal(val, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Type
+//===--------------------------------------------------------------------===//
+LogicalType JSONBinary::GetType() {
+	auto type = LogicalType(LogicalTypeId::BLOB);
+	type.SetAlias(TYPE_NAME);
+	return type;
+}
+
+bool JSONBinary::IsJSONBinaryType(const LogicalType &type) {
+	return type.id() == LogicalTypeId::BLOB && type.HasAlias() && type.GetAlias() == TYPE_NAME;
+}
+
+//===--------------------------------------------------------------------===//
+// Casts
+//===--------------------------------------------------------------------===//
+static bool CastJSONToJSONBinary(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &lstate = parameters.local_state->Cast<JSONFunctionLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	vector<data_t> buffer;
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    auto data = input.GetDataWriteable();
+		    const auto length = input.GetSize();
+
+		    yyjson_read_err error;
+		    auto doc = JSONCommon::ReadDocumentUnsafe(data, length, JSONCommon::READ_FLAG, alc, &error);
+		    if (!doc) {
+			    mask.SetInvalid(idx);
+			    if (success) {
+				    HandleCastError::AssignError(JSONCommon::FormatParseError(data, length, error), parameters);
+				    success = false;
+			    }
+			    return string_t();
+		    }
+
+		    JSONBinary::Encode(doc->root, buffer);
+		    return StringVector::AddStringOrBlob(result, const_char_ptr_cast(buffer.data()), buffer.size());
+	    });
+	return success;
+}
+
+static bool CastJSONBinaryToJSON(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &lstate = parameters.local_state->Cast<JSONFunctionLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	UnaryExecutor::Execute<string_t, string_t>(source, result, count, [&](string_t input) {
+		return StringVector::AddString(result, JSONBinary::ToJSON(JSONBinaryValue(input), alc));
+	});
+	return true;
+}
+
+static bool CastBlobToJSONBinary(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    if (!JSONBinary::Verify(JSONBinaryValue(input))) {
+			    mask.SetInvalid(idx);
+			    if (success) {
+				    HandleCastError::AssignError(
+				        StringUtil::Format("BLOB is not a valid %s document", JSONBinary::TYPE_NAME), parameters);
+				    success = false;
+			    }
+		    }
+		    return input;
+	    });
+	StringVector::AddHeapReference(result, source);
+	return success;
+}
+
+void JSONFunctions::RegisterJSONBinaryCastFunctions(CastFunctionSet &casts) {
+	const auto jsonb_type = JSONBinary::GetType();
+
+	// Encoding requires a parse, make this more expensive than VARCHAR to JSON
+	auto json_to_jsonb_cost = casts.ImplicitCastCost(LogicalType::VARCHAR, LogicalType::JSON()) + 1;
+	BoundCastInfo json_to_jsonb_info(CastJSONToJSONBinary, nullptr, JSONFunctionLocalState::InitCastLocalState);
+	casts.RegisterCastFunction(LogicalType::VARCHAR, jsonb_type, json_to_jsonb_info.Copy(), json_to_jsonb_cost);
+	casts.RegisterCastFunction(LogicalType::JSON(), jsonb_type, std::move(json_to_jsonb_info), json_to_jsonb_cost);
+
+	// Decoding is cheaper, but JSON should be preferred over VARCHAR so the binder can disambiguate functions
+	auto jsonb_to_json_cost = casts.ImplicitCastCost(LogicalType::SQLNULL, LogicalTypeId::STRUCT) + 1;
+	BoundCastInfo jsonb_to_json_info(CastJSONBinaryToJSON, nullptr, JSONFunctionLocalState::InitCastLocalState);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::JSON(), jsonb_to_json_info.Copy(), jsonb_to_json_cost);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::VARCHAR, std::move(jsonb_to_json_info),
+	                           jsonb_to_json_cost + 1);
+
+	// A BLOB has to be verified before it can be used as JSONB, and JSONB is a BLOB
+	casts.RegisterCastFunction(LogicalType::BLOB, jsonb_type, CastBlobToJSONBinary);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 0);
+
+	// NULL to JSONB, like NULL to JSON
+	auto null_to_jsonb_cost = casts.ImplicitCastCost(LogicalType::SQLNULL, LogicalTypeId::VARCHAR) + 2;
+	casts.RegisterCastFunction(LogicalType::SQLNULL, jsonb_type, DefaultCasts::TryVectorNullCast, null_to_jsonb_cost);
+}
+
+} // namespace duckdb
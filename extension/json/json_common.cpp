@@ -266,6 +266,76 @@ yyjson_val *JSONCommon::GetPath(yyjson_val *val, const char *ptr, const idx_t &l
 	return val;
 }
 
+static void SplitPointer(const char *ptr, const char *const end, vector<JSONPathElement> &elements) {
+	D_ASSERT(ptr != end && *ptr == '/');
+	if (end - ptr == 1) {
+		// A single '/' refers to the root
+		return;
+	}
+	while (ptr != end) {
+		ptr++; // Skip past '/'
+		JSONPathElement element {JSONPathElement::Type::POINTER_TOKEN, string(), DConstants::INVALID_INDEX, false};
+		while (ptr != end && *ptr != '/') {
+			if (*ptr == '~' && ptr + 1 != end && (ptr[1] == '0' || ptr[1] == '1')) {
+				element.key += ptr[1] == '0' ? '~' : '/';
+				ptr += 2;
+			} else {
+				element.key += *ptr++;
+			}
+		}
+		// The token can only index an array if it is a number without leading zeros
+		const auto &key = element.key;
+		if (!key.empty() && key.size() <= 18 && (key[0] != '0' || key.size() == 1)) {
+			idx_t index = 0;
+			for (auto &c : key) {
+				if (!StringUtil::CharacterIsDigit(c)) {
+					index = DConstants::INVALID_INDEX;
+					break;
+				}
+				index = index * 10 + idx_t(c - '0');
+			}
+			element.index = index;
+		}
+		elements.push_back(std::move(element));
+	}
+}
+
+void JSONCommon::SplitPath(const char *ptr, const idx_t &len, vector<JSONPathElement> &elements) {
+	// Path has been validated at this point
+	const char *const end = ptr + len;
+	if (*ptr == '/') {
+		SplitPointer(ptr, end, elements);
+		return;
+	}
+	D_ASSERT(*ptr == '$');
+	ptr++; // Skip past '$'
+	while (ptr != end) {
+		const auto &c = *ptr++;
+		D_ASSERT(ptr != end);
+		switch (c) {
+		case '.': { // Object field
+			auto key_result = ReadKey(ptr, end);
+			D_ASSERT(key_result.IsValid() && !key_result.IsWildCard());
+			ptr += key_result.chars_read;
+			elements.push_back({JSONPathElement::Type::KEY, std::move(key_result.key), 0, false});
+			break;
+		}
+		case '[': { // Array index
+			idx_t array_index;
+			bool from_back;
+			if (!ReadArrayIndex(ptr, end, array_index, from_back) || array_index == DConstants::INVALID_INDEX) {
+				throw InternalException("Invalid JSON Path encountered in JSONCommon::SplitPath");
+			}
+			elements.push_back({JSONPathElement::Type::INDEX, string(), array_index, from_back});
+			break;
+		}
+		default: // LCOV_EXCL_START
+			throw InternalException(
+			    "Invalid JSON Path encountered in JSONCommon::SplitPath, call JSONCommon::ValidatePath first!");
+		} // LCOV_EXCL_STOP
+	}
+}
+
 void GetWildcardPathInternal(yyjson_val *val, const char *ptr, const char *const end, vector<yyjson_val *> &vals) {
 	while (val != nullptr && ptr != end) {
 		const auto &c = *ptr++;
@@ -10,6 +10,7 @@ source_files = [
         'extension/json/json_enums.cpp',
         'extension/json/json_extension.cpp',
         'extension/json/json_common.cpp',
+        'extension/json/json_binary.cpp',
         'extension/json/json_functions.cpp',
         'extension/json/json_scan.cpp',
         'extension/json/json_functions/copy_json.cpp',
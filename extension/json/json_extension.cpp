@@ -11,6 +11,7 @@
 #include "duckdb/parser/parsed_data/create_pragma_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_type_info.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "json_binary.hpp"
 #include "json_common.hpp"
 #include "json_functions.hpp"
 
@@ -29,10 +30,14 @@ void JsonExtension::Load(DuckDB &db) {
 	auto json_type = LogicalType::JSON();
 	ExtensionUtil::RegisterType(db_instance, LogicalType::JSON_TYPE_NAME, std::move(json_type));
 
+	// JSONB type
+	ExtensionUtil::RegisterType(db_instance, JSONBinary::TYPE_NAME, JSONBinary::GetType());
+
 	// JSON casts
 	JSONFunctions::RegisterSimpleCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
 	JSONFunctions::RegisterJSONCreateCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
 	JSONFunctions::RegisterJSONTransformCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
+	JSONFunctions::RegisterJSONBinaryCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
 
 	// JSON scalar functions
 	for (auto &fun : JSONFunctions::GetScalarFunctions()) {
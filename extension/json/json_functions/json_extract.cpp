@@ -1,3 +1,5 @@
+#include "duckdb/storage/table/json_column_data.hpp"
+#include "json_binary.hpp"
 #include "json_executors.hpp"
 
 namespace duckdb {
@@ -19,7 +21,42 @@ static void ExtractManyFunction(DataChunk &args, ExpressionState &state, Vector
 	JSONExecutors::ExecuteMany<string_t>(args, state, result, ExtractFromVal);
 }
 
+//! Reads the values of a path from the shredded sub-columns of a scanned JSON column, instead of parsing the documents
+static bool TryExtractShreddedString(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	const auto &info = func_expr.bind_info->Cast<JSONReadFunctionData>();
+	if (!info.constant || info.path_type != JSONCommon::JSONPathType::REGULAR) {
+		return false;
+	}
+	auto &inputs = args.data[0];
+	optional_ptr<const SelectionVector> sel;
+	reference<Vector> scanned_vector(inputs);
+	if (inputs.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		// e.g., the rows that passed a filter
+		sel = &DictionaryVector::SelVector(inputs);
+		scanned_vector = DictionaryVector::Child(inputs);
+	}
+	auto shredded = ShreddedJSONAuxiliaryData::Get(scanned_vector.get());
+	string path;
+	if (!shredded || !JSONColumnData::TryNormalizePath(info.path, path)) {
+		return false;
+	}
+	Vector values(LogicalType::VARCHAR, shredded->count);
+	if (!shredded->TryScan(path, values)) {
+		return false;
+	}
+	if (sel) {
+		result.Slice(values, *sel, args.size());
+	} else {
+		result.Reference(values);
+	}
+	return true;
+}
+
 static void ExtractStringFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	if (TryExtractShreddedString(args, state, result)) {
+		return;
+	}
 	JSONExecutors::BinaryExecute<string_t>(args, state, result, ExtractStringFromVal);
 }
 
@@ -27,6 +64,164 @@ static void ExtractStringManyFunction(DataChunk &args, ExpressionState &state, V
 	JSONExecutors::ExecuteMany<string_t>(args, state, result, ExtractStringFromVal);
 }
 
+//===--------------------------------------------------------------------===//
+// JSONB
+//===--------------------------------------------------------------------===//
+static inline string_t ExtractFromBinaryVal(const JSONBinaryValue &val, yyjson_alc *) {
+	// Nested values are valid JSONB documents: no need to re-encode
+	return val.AsBinary();
+}
+
+static inline string_t ExtractStringFromBinaryVal(const JSONBinaryValue &val, yyjson_alc *alc) {
+	return val.GetType() == JSONBinaryType::STRING ? val.GetString() : JSONBinary::ToJSON(val, alc);
+}
+
+//! Splits a non-constant path, like JSONCommon::Get
+static void SplitNonConstantPath(const string_t &path_str, vector<JSONPathElement> &path) {
+	path.clear();
+	auto ptr = path_str.GetData();
+	auto len = path_str.GetSize();
+	switch (*ptr) {
+	case '/':
+		JSONCommon::SplitPath(ptr, len, path);
+		break;
+	case '$':
+		if (JSONCommon::ValidatePath(ptr, len, false) == JSONCommon::JSONPathType::WILDCARD) {
+			throw InvalidInputException("JSON path cannot contain wildcards if the path is not a constant parameter");
+		}
+		JSONCommon::SplitPath(ptr, len, path);
+		break;
+	default: {
+		auto str = "/" + string(ptr, len);
+		JSONCommon::SplitPath(str.c_str(), len + 1, path);
+		break;
+	}
+	}
+}
+
+template <string_t (*FUN)(const JSONBinaryValue &, yyjson_alc *)>
+static void ExtractBinaryFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	const auto &info = func_expr.bind_info->Cast<JSONReadFunctionData>();
+	auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	auto &inputs = args.data[0];
+	vector<JSONPathElement> path;
+	if (info.constant) { // Constant path
+		JSONCommon::SplitPath(info.ptr, info.len, path);
+		UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+		    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
+			    auto val = JSONBinaryValue(input).GetPath(path);
+			    if (!val.IsValid() || val.IsNull()) {
+				    mask.SetInvalid(idx);
+				    return string_t {};
+			    }
+			    return FUN(val, alc);
+		    });
+	} else { // Columnref path
+		auto &paths = args.data[1];
+		BinaryExecutor::ExecuteWithNulls<string_t, string_t, string_t>(
+		    inputs, paths, result, args.size(), [&](string_t input, string_t path_str, ValidityMask &mask, idx_t idx) {
+			    JSONBinaryValue val;
+			    if (path_str.GetSize() != 0) {
+				    SplitNonConstantPath(path_str, path);
+				    val = JSONBinaryValue(input).GetPath(path);
+			    }
+			    if (!val.IsValid() || val.IsNull()) {
+				    mask.SetInvalid(idx);
+				    return string_t {};
+			    }
+			    return FUN(val, alc);
+		    });
+	}
+	// Extracted values point into the input
+	StringVector::AddHeapReference(result, inputs);
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+template <string_t (*FUN)(const JSONBinaryValue &, yyjson_alc *)>
+static void ExtractBinaryManyFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+	const auto &info = func_expr.bind_info->Cast<JSONReadManyFunctionData>();
+	auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	const auto count = args.size();
+	const idx_t num_paths = info.ptrs.size();
+	vector<vector<JSONPathElement>> paths(num_paths);
+	for (idx_t path_i = 0; path_i < num_paths; path_i++) {
+		JSONCommon::SplitPath(info.ptrs[path_i], info.lens[path_i], paths[path_i]);
+	}
+
+	UnifiedVectorFormat input_data;
+	auto &input_vector = args.data[0];
+	input_vector.ToUnifiedFormat(count, input_data);
+	auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+	ListVector::Reserve(result, count * num_paths);
+	auto list_entries = FlatVector::GetData<list_entry_t>(result);
+	auto &list_validity = FlatVector::Validity(result);
+
+	auto &child = ListVector::GetEntry(result);
+	auto child_data = FlatVector::GetData<string_t>(child);
+	auto &child_validity = FlatVector::Validity(child);
+
+	idx_t offset = 0;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		if (!input_data.validity.RowIsValid(idx)) {
+			list_validity.SetInvalid(i);
+			continue;
+		}
+
+		JSONBinaryValue doc(inputs[idx]);
+		for (idx_t path_i = 0; path_i < num_paths; path_i++) {
+			auto child_idx = offset + path_i;
+			auto val = doc.GetPath(paths[path_i]);
+			if (!val.IsValid() || val.IsNull()) {
+				child_validity.SetInvalid(child_idx);
+			} else {
+				child_data[child_idx] = FUN(val, alc);
+			}
+		}
+
+		list_entries[i].offset = offset;
+		list_entries[i].length = num_paths;
+		offset += num_paths;
+	}
+	ListVector::SetListSize(result, offset);
+	StringVector::AddHeapReference(child, input_vector);
+
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+static unique_ptr<FunctionData> JSONBinaryReadBind(ClientContext &context, ScalarFunction &bound_function,
+                                                   vector<unique_ptr<Expression>> &arguments) {
+	auto result = JSONReadFunctionData::Bind(context, bound_function, arguments);
+	if (result->Cast<JSONReadFunctionData>().path_type == JSONCommon::JSONPathType::WILDCARD) {
+		throw BinderException("Wildcards in JSON paths are not supported for %s, cast to JSON first",
+		                      JSONBinary::TYPE_NAME);
+	}
+	return result;
+}
+
+static void GetExtractBinaryFunctionsInternal(ScalarFunctionSet &set, const LogicalType &return_type,
+                                              scalar_function_t function, scalar_function_t many_function) {
+	const auto input_type = JSONBinary::GetType();
+	set.AddFunction(ScalarFunction({input_type, LogicalType::BIGINT}, return_type, function, JSONBinaryReadBind,
+	                               nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({input_type, LogicalType::VARCHAR}, return_type, function, JSONBinaryReadBind,
+	                               nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({input_type, LogicalType::LIST(LogicalType::VARCHAR)},
+	                               LogicalType::LIST(return_type), many_function, JSONReadManyFunctionData::Bind,
+	                               nullptr, nullptr, JSONFunctionLocalState::Init));
+}
+
 static void GetExtractFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type, LogicalType::BIGINT}, LogicalType::JSON(), ExtractFunction,
 	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
@@ -42,6 +237,8 @@ ScalarFunctionSet JSONFunctions::GetExtractFunction() {
 	ScalarFunctionSet set("json_extract");
 	GetExtractFunctionsInternal(set, LogicalType::VARCHAR);
 	GetExtractFunctionsInternal(set, LogicalType::JSON());
+	GetExtractBinaryFunctionsInternal(set, JSONBinary::GetType(), ExtractBinaryFunction<ExtractFromBinaryVal>,
+	                                  ExtractBinaryManyFunction<ExtractFromBinaryVal>);
 	return set;
 }
 
@@ -60,6 +257,8 @@ ScalarFunctionSet JSONFunctions::GetExtractStringFunction() {
 	ScalarFunctionSet set("json_extract_string");
 	GetExtractStringFunctionsInternal(set, LogicalType::VARCHAR);
 	GetExtractStringFunctionsInternal(set, LogicalType::JSON());
+	GetExtractBinaryFunctionsInternal(set, LogicalType::VARCHAR, ExtractBinaryFunction<ExtractStringFromBinaryVal>,
+	                                  ExtractBinaryManyFunction<ExtractStringFromBinaryVal>);
 	return set;
 }
 
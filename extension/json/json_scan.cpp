@@ -146,12 +146,20 @@ JSONScanGlobalState::JSONScanGlobalState(ClientContext &context, const JSONScanD
       buffer_capacity(bind_data.maximum_object_size * 2), file_index(0), batch_index(0),
       system_threads(TaskScheduler::GetScheduler(context).NumberOfThreads()),
       enable_parallel_scans(bind_data.files.size() < system_threads) {
+	// a thread parsing a stream holds its buffer, the previous buffer (until its last object is reconstructed) and a
+	// reconstruct buffer: the buffers of all threads may take up at most half of the memory limit
+	auto thread_memory = 2 * buffer_capacity + bind_data.maximum_object_size;
+	auto max_threads = BufferManager::GetBufferManager(context).GetQueryMaxMemory() / 2 / thread_memory;
+	stream_threads = MaxValue<idx_t>(MinValue<idx_t>(system_threads, max_threads), 1);
 }
 
 JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalState &gstate)
     : scan_count(0), batch_index(DConstants::INVALID_INDEX), total_read_size(0), total_tuple_count(0),
       bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), is_last(false),
       fs(FileSystem::GetFileSystem(context)), buffer_size(0), buffer_offset(0), prev_buffer_remainder(0) {
+	if (!gstate.projected_keys.empty()) {
+		projected_keys = &gstate.projected_keys;
+	}
 }
 
 JSONGlobalTableFunctionState::JSONGlobalTableFunctionState(ClientContext &context, TableFunctionInitInput &input)
@@ -193,6 +201,14 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 		gstate.transform_options.error_unknown_key = false;
 	}
 
+	if (bind_data.type == JSONScanType::READ_JSON && bind_data.options.record_type == JSONRecordType::RECORDS &&
+	    !gstate.names.empty() && gstate.names.size() < bind_data.names.size()) {
+		// Only some of the columns are needed: skip over the other fields of the records instead of parsing them
+		for (const auto &name : gstate.names) {
+			gstate.projected_keys.insert({name.c_str(), name.length()});
+		}
+	}
+
 	// Place readers where they belong
 	if (bind_data.initial_reader) {
 		bind_data.initial_reader->Reset();
@@ -221,8 +237,13 @@ idx_t JSONGlobalTableFunctionState::MaxThreads() const {
 		auto &reader = *state.json_readers[0];
 		if (bind_data.options.format == JSONFormat::NEWLINE_DELIMITED ||
 		    reader.GetFormat() == JSONFormat::NEWLINE_DELIMITED) {
-			return MaxValue<idx_t>(state.json_readers[0]->GetFileHandle().FileSize() / bind_data.maximum_object_size,
-			                       1);
+			auto &file_handle = reader.GetFileHandle();
+			if (!file_handle.CanSeek()) {
+				// We don't know how much data a pipe or a compressed file holds: buffers are read from the stream one
+				// at a time (holding the reader lock), and the threads parse the buffers that were read in parallel
+				return state.stream_threads;
+			}
+			return MaxValue<idx_t>(file_handle.FileSize() / bind_data.maximum_object_size, 1);
 		}
 	}
 
@@ -377,7 +398,223 @@ static inline void TrimWhitespace(JSONString &line) {
 	}
 }
 
+//! Character classes used to skip over the fields of records that are not projected
+enum class JSONSkipClass : uint8_t { OTHER, WHITESPACE, QUOTE, OPEN, CLOSE, SCALAR };
+
+struct JSONSkipTable {
+	JSONSkipTable() {
+		for (idx_t c = 0; c < 256; c++) {
+			classes[c] = JSONSkipClass::OTHER;
+		}
+		for (auto c : {' ', '\t', '\n', '\r'}) {
+			classes[static_cast<uint8_t>(c)] = JSONSkipClass::WHITESPACE;
+		}
+		classes[static_cast<uint8_t>('"')] = JSONSkipClass::QUOTE;
+		classes[static_cast<uint8_t>('{')] = JSONSkipClass::OPEN;
+		classes[static_cast<uint8_t>('[')] = JSONSkipClass::OPEN;
+		classes[static_cast<uint8_t>('}')] = JSONSkipClass::CLOSE;
+		classes[static_cast<uint8_t>(']')] = JSONSkipClass::CLOSE;
+		// Numbers and literals, including NaN and Infinity
+		for (idx_t c = 0; c < 256; c++) {
+			const auto chr = static_cast<char>(c);
+			if (StringUtil::CharacterIsAlpha(chr) || StringUtil::CharacterIsDigit(chr) || chr == '-' || chr == '+' ||
+			    chr == '.') {
+				classes[c] = JSONSkipClass::SCALAR;
+			}
+		}
+	}
+
+	inline JSONSkipClass Get(char c) const {
+		return classes[static_cast<uint8_t>(c)];
+	}
+
+	JSONSkipClass classes[256];
+};
+
+static const JSONSkipTable &GetJSONSkipTable() {
+	static const JSONSkipTable table;
+	return table;
+}
+
+static inline void SkipJSONWhitespace(const JSONSkipTable &table, const char *ptr, idx_t &pos, const idx_t size) {
+	while (pos < size && table.Get(ptr[pos]) == JSONSkipClass::WHITESPACE) {
+		pos++;
+	}
+}
+
+//! Skips over a string, starting at the opening quote. Sets has_escape if the string contains escape sequences
+static inline bool SkipJSONString(const char *ptr, idx_t &pos, const idx_t size, bool &has_escape) {
+	D_ASSERT(ptr[pos] == '"');
+	for (pos++; pos < size; pos++) {
+		if (ptr[pos] == '"') {
+			pos++;
+			return true;
+		}
+		if (ptr[pos] == '\\') {
+			has_escape = true;
+			pos++;
+		}
+	}
+	return false;
+}
+
+//! Skips over a value without parsing it: only the structure is checked, i.e., that strings are terminated and that
+//! brackets match. Scalars and the contents of skipped strings are not validated.
+static bool SkipJSONValue(const JSONSkipTable &table, const char *ptr, idx_t &pos, const idx_t size) {
+	static constexpr idx_t MAX_DEPTH = 1024;
+	bool has_escape = false;
+	switch (table.Get(ptr[pos])) {
+	case JSONSkipClass::QUOTE:
+		return SkipJSONString(ptr, pos, size, has_escape);
+	case JSONSkipClass::SCALAR: {
+		const auto start = pos;
+		while (pos < size && table.Get(ptr[pos]) == JSONSkipClass::SCALAR) {
+			pos++;
+		}
+		return pos != start;
+	}
+	case JSONSkipClass::OPEN:
+		break;
+	default:
+		return false;
+	}
+
+	// Nested object or array: only look at the structural characters
+	char closers[MAX_DEPTH];
+	idx_t depth = 0;
+	while (pos < size) {
+		const auto c = ptr[pos];
+		switch (table.Get(c)) {
+		case JSONSkipClass::QUOTE:
+			if (!SkipJSONString(ptr, pos, size, has_escape)) {
+				return false;
+			}
+			continue;
+		case JSONSkipClass::OPEN:
+			if (depth == MAX_DEPTH) {
+				return false;
+			}
+			closers[depth++] = c == '{' ? '}' : ']';
+			break;
+		case JSONSkipClass::CLOSE:
+			if (closers[--depth] != c) {
+				return false;
+			}
+			if (depth == 0) {
+				pos++;
+				return true;
+			}
+			break;
+		default:
+			break;
+		}
+		pos++;
+	}
+	return false;
+}
+
+bool JSONScanLocalState::ParseJSONProjected(const char *const json_start, const idx_t json_size) {
+	auto &table = GetJSONSkipTable();
+	idx_t pos = 0;
+	SkipJSONWhitespace(table, json_start, pos, json_size);
+	if (pos == json_size || json_start[pos] != '{') {
+		return false;
+	}
+	pos++;
+
+	// Copy the fields that we need into a (smaller) object, and parse that instead
+	auto projected_json = JSONCommon::AllocateArray<char>(GetAllocator(), json_size + YYJSON_PADDING_SIZE);
+	idx_t projected_size = 0;
+	projected_json[projected_size++] = '{';
+	while (true) {
+		SkipJSONWhitespace(table, json_start, pos, json_size);
+		if (pos == json_size) {
+			return false;
+		}
+		if (json_start[pos] == '}') {
+			// End of the object (possibly after a trailing comma)
+			pos++;
+			break;
+		}
+		if (json_start[pos] != '"') {
+			return false;
+		}
+
+		// Key
+		const auto field_start = pos;
+		bool has_escape = false;
+		if (!SkipJSONString(json_start, pos, json_size, has_escape)) {
+			return false;
+		}
+		const auto key_end = pos;
+		SkipJSONWhitespace(table, json_start, pos, json_size);
+		if (pos == json_size || json_start[pos] != ':') {
+			return false;
+		}
+		pos++;
+
+		// Value
+		SkipJSONWhitespace(table, json_start, pos, json_size);
+		if (pos == json_size) {
+			return false;
+		}
+		const auto value_start = pos;
+		if (!SkipJSONValue(table, json_start, pos, json_size)) {
+			return false;
+		}
+
+		// Keys with escape sequences are always kept, we would have to unescape them to compare them
+		const auto key_ptr = json_start + field_start + 1;
+		const auto key_len = key_end - field_start - 2;
+		if (has_escape || projected_keys->find({key_ptr, key_len}) != projected_keys->end()) {
+			if (projected_size != 1) {
+				projected_json[projected_size++] = ',';
+			}
+			memcpy(projected_json + projected_size, json_start + field_start, key_end - field_start);
+			projected_size += key_end - field_start;
+			projected_json[projected_size++] = ':';
+			memcpy(projected_json + projected_size, json_start + value_start, pos - value_start);
+			projected_size += pos - value_start;
+		}
+
+		SkipJSONWhitespace(table, json_start, pos, json_size);
+		if (pos == json_size) {
+			return false;
+		}
+		if (json_start[pos] == ',') {
+			pos++;
+		} else if (json_start[pos] != '}') {
+			return false;
+		}
+	}
+	// Between the end of the record and the boundary should be whitespace only
+	SkipJSONWhitespace(table, json_start, pos, json_size);
+	if (pos != json_size) {
+		return false;
+	}
+	projected_json[projected_size++] = '}';
+	memset(projected_json + projected_size, 0, YYJSON_PADDING_SIZE);
+
+	yyjson_read_err err;
+	auto doc = JSONCommon::ReadDocumentUnsafe(projected_json, projected_size, JSONCommon::READ_INSITU_FLAG,
+	                                          allocator.GetYYAlc(), &err);
+	if (err.code != YYJSON_READ_SUCCESS) {
+		// One of the values we need is malformed, parse the whole record to report the error
+		return false;
+	}
+
+	lines_or_objects_in_buffer++;
+	units[scan_count] = JSONString(json_start, json_size);
+	TrimWhitespace(units[scan_count]);
+	values[scan_count] = doc->root;
+	return true;
+}
+
 void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+	if (projected_keys && ParseJSONProjected(json_start, json_size)) {
+		return;
+	}
+
 	yyjson_doc *doc;
 	yyjson_read_err err;
 	if (bind_data.type == JSONScanType::READ_JSON_OBJECTS) { // If we return strings, we cannot parse INSITU
@@ -788,7 +1025,8 @@ AllocatedData JSONScanLocalState::AllocateBuffer(JSONScanGlobalState &gstate) {
 
 data_ptr_t JSONScanLocalState::GetReconstructBuffer(JSONScanGlobalState &gstate) {
 	if (!reconstruct_buffer.IsSet()) {
-		reconstruct_buffer = gstate.allocator.Allocate(gstate.buffer_capacity);
+		// the reconstruct buffer holds a single object, which may not exceed the maximum object size
+		reconstruct_buffer = gstate.allocator.Allocate(bind_data.maximum_object_size + YYJSON_PADDING_SIZE);
 	}
 	return reconstruct_buffer.get();
 }
@@ -836,6 +1074,9 @@ bool JSONScanLocalState::ReconstructFirstObject(JSONScanGlobalState &gstate) {
 	auto prev_buffer_ptr = char_ptr_cast(previous_buffer_handle->buffer.get()) + previous_buffer_handle->buffer_size;
 	auto part1_ptr = PreviousNewline(prev_buffer_ptr, previous_buffer_handle->buffer_size);
 	auto part1_size = prev_buffer_ptr - part1_ptr;
+	if (idx_t(part1_size) > bind_data.maximum_object_size) {
+		ThrowObjectSizeError(part1_size);
+	}
 
 	// Now copy the data to our reconstruct buffer
 	const auto reconstruct_ptr = GetReconstructBuffer(gstate);
@@ -365,6 +365,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
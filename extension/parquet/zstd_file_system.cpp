@@ -180,4 +180,50 @@ idx_t ZStdFileSystem::OutBufferSize() {
 	return duckdb_zstd::ZSTD_DStreamOutSize();
 }
 
+bool ZStdFileSystem::SupportsParallelDecompression() {
+	return true;
+}
+
+idx_t ZStdFileSystem::FindFrameEnd(const_data_ptr_t data, idx_t size) {
+	auto frame_size = duckdb_zstd::ZSTD_findFrameCompressedSize(data, size);
+	if (duckdb_zstd::ZSTD_isError(frame_size)) {
+		// the frame is incomplete (or corrupt, which is reported when decompressing)
+		return 0;
+	}
+	return frame_size;
+}
+
+bool ZStdFileSystem::DecompressFrames(const_data_ptr_t data, idx_t size, unsafe_vector<data_t> &result) {
+	auto zstd_stream_ptr = duckdb_zstd::ZSTD_createDStream();
+	duckdb_zstd::ZSTD_inBuffer in_buffer;
+	in_buffer.src = data;
+	in_buffer.size = size;
+	in_buffer.pos = 0;
+
+	idx_t result_size = result.size();
+	size_t res;
+	while (true) {
+		if (result_size == result.size()) {
+			result.resize(MaxValue<idx_t>(result.size() * 2, size * 4));
+		}
+		duckdb_zstd::ZSTD_outBuffer out_buffer;
+		out_buffer.dst = result.data() + result_size;
+		out_buffer.size = result.size() - result_size;
+		out_buffer.pos = 0;
+		res = duckdb_zstd::ZSTD_decompressStream(zstd_stream_ptr, &out_buffer, &in_buffer);
+		result_size += out_buffer.pos;
+		if (duckdb_zstd::ZSTD_isError(res) || (in_buffer.pos == in_buffer.size && out_buffer.pos < out_buffer.size)) {
+			// an error, or all frames have been decompressed and flushed, or the last frame is incomplete
+			break;
+		}
+	}
+	duckdb_zstd::ZSTD_freeDStream(zstd_stream_ptr);
+	result.resize(result_size);
+	if (duckdb_zstd::ZSTD_isError(res)) {
+		throw IOException(duckdb_zstd::ZSTD_getErrorName(res));
+	}
+	// ZSTD_decompressStream returns 0 once a frame is completely decoded and flushed
+	return res == 0;
+}
+
 } // namespace duckdb
@@ -5,6 +5,7 @@
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/parser/constraints/list.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
 #include "duckdb/parser/parsed_expression_iterator.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/constraints/bound_check_constraint.hpp"
@@ -94,9 +95,21 @@ DuckTableEntry::DuckTableEntry(Catalog &catalog, SchemaCatalogEntry &schema, Bou
 		for (auto &col_def : columns.Physical()) {
 			storage_columns.push_back(col_def.Copy());
 		}
-		storage =
-		    make_shared_ptr<DataTable>(catalog.GetAttached(), StorageManager::Get(catalog).GetTableIOManager(&info),
-		                               schema.name, name, std::move(storage_columns), std::move(info.data));
+		auto &base = info.Base();
+		auto row_group_size =
+		    base.row_group_size.IsValid() ? base.row_group_size.GetIndex() : Storage::ROW_GROUP_SIZE;
+		storage = make_shared_ptr<DataTable>(catalog.GetAttached(),
+		                                     StorageManager::Get(catalog).GetTableIOManager(&info), schema.name, name,
+		                                     std::move(storage_columns), std::move(info.data), row_group_size);
+		if (!base.order_by.empty()) {
+			vector<TableSortKey> sort_keys;
+			for (auto &order : base.order_by) {
+				auto &colref = order.expression->Cast<ColumnRefExpression>();
+				auto &column = columns.GetColumn(colref.GetColumnName());
+				sort_keys.emplace_back(column.Physical(), order.type, order.null_order);
+			}
+			storage->SetSortKeys(std::move(sort_keys));
+		}
 
 		// create the unique indexes for the UNIQUE and PRIMARY KEY and FOREIGN KEY constraints
 		idx_t indexes_idx = 0;
@@ -803,6 +816,21 @@ unique_ptr<CatalogEntry> DuckTableEntry::Copy(ClientContext &context) const {
 	return make_uniq<DuckTableEntry>(catalog, schema, *bound_create_info, storage);
 }
 
+unique_ptr<CreateInfo> DuckTableEntry::GetInfo() const {
+	auto result = TableCatalogEntry::GetInfo();
+	auto row_group_size = storage->GetRowGroupSize();
+	if (row_group_size != Storage::ROW_GROUP_SIZE) {
+		result->Cast<CreateTableInfo>().row_group_size = row_group_size;
+	}
+	// the sort keys refer to physical columns - emit them using the current column names
+	for (auto &sort_key : storage->GetSortKeys()) {
+		auto &column = columns.GetColumn(sort_key.column);
+		result->Cast<CreateTableInfo>().order_by.emplace_back(sort_key.type, sort_key.null_order,
+		                                                      make_uniq<ColumnRefExpression>(column.Name()));
+	}
+	return result;
+}
+
 void DuckTableEntry::SetAsRoot() {
 	storage->SetAsRoot();
 	storage->SetTableName(name);
@@ -28,12 +28,30 @@ void CompressedFile::Initialize(bool write) {
 	stream_data.out_buff_start = stream_data.out_buff.get();
 	stream_data.out_buff_end = stream_data.out_buff.get();
 
+	if (!write && decompression_threads > 1 && child_handle->CanSeek() &&
+	    compressed_fs.SupportsParallelDecompression()) {
+		parallel_decompressor = make_uniq<ParallelDecompressor>(compressed_fs, *child_handle, decompression_threads);
+		return;
+	}
 	stream_wrapper = compressed_fs.CreateStream();
 	stream_wrapper->Initialize(*this, write);
 }
 
 int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
 	idx_t total_read = 0;
+	if (parallel_decompressor) {
+		total_read = parallel_decompressor->Read(data_ptr_cast(buffer), UnsafeNumericCast<idx_t>(remaining));
+		remaining -= UnsafeNumericCast<int64_t>(total_read);
+		idx_t position;
+		if (remaining == 0 || !parallel_decompressor->RequiresSequentialRead(position)) {
+			return UnsafeNumericCast<int64_t>(total_read);
+		}
+		// the end of a frame could not be found: decompress the remainder of the file sequentially
+		parallel_decompressor.reset();
+		child_handle->Seek(position);
+		stream_wrapper = compressed_fs.CreateStream();
+		stream_wrapper->Initialize(*this, write);
+	}
 	while (true) {
 		// first check if there are input bytes available in the output buffers
 		if (stream_data.out_buff_start != stream_data.out_buff_end) {
@@ -109,6 +127,7 @@ void CompressedFile::Close() {
 		stream_wrapper->Close();
 		stream_wrapper.reset();
 	}
+	parallel_decompressor.reset();
 	stream_data.in_buff.reset();
 	stream_data.out_buff.reset();
 	stream_data.out_buff_start = nullptr;
@@ -150,4 +169,199 @@ bool CompressedFileSystem::CanSeek() {
 	return false;
 }
 
+void CompressedFileSystem::SetDecompressionThreads(FileHandle &handle, idx_t threads) {
+	auto &compressed_file = handle.Cast<CompressedFile>();
+	if (compressed_file.write || compressed_file.decompression_threads == threads) {
+		return;
+	}
+	compressed_file.decompression_threads = threads;
+	// re-initialize the file (which was opened and verified for sequential reading)
+	Reset(handle);
+}
+
+bool CompressedFileSystem::SupportsParallelDecompression() {
+	return false;
+}
+
+idx_t CompressedFileSystem::FindFrameEnd(const_data_ptr_t data, idx_t size) {
+	throw NotImplementedException("%s: FindFrameEnd is not implemented!", GetName());
+}
+
+bool CompressedFileSystem::DecompressFrames(const_data_ptr_t data, idx_t size, unsafe_vector<data_t> &result) {
+	throw NotImplementedException("%s: DecompressFrames is not implemented!", GetName());
+}
+
+ParallelDecompressor::ParallelDecompressor(CompressedFileSystem &compressed_fs_p, FileHandle &child_handle_p,
+                                           idx_t thread_count)
+    : compressed_fs(compressed_fs_p), child_handle(child_handle_p), max_units_in_flight(thread_count * 2) {
+	for (idx_t i = 0; i < thread_count; i++) {
+		threads.emplace_back([this]() { WorkerThread(); });
+	}
+}
+
+ParallelDecompressor::~ParallelDecompressor() {
+	{
+		lock_guard<mutex> guard(lock);
+		shutdown = true;
+	}
+	work_available.notify_all();
+	for (auto &worker : threads) {
+		worker.join();
+	}
+}
+
+void ParallelDecompressor::WorkerThread() {
+	while (true) {
+		unique_lock<mutex> guard(lock);
+		work_available.wait(guard, [&]() { return shutdown || !work_queue.empty(); });
+		if (shutdown) {
+			return;
+		}
+		auto &unit = work_queue.front().get();
+		work_queue.pop_front();
+		guard.unlock();
+
+		Decompress(unit);
+
+		guard.lock();
+		unit.finished = true;
+		guard.unlock();
+		work_finished.notify_all();
+	}
+}
+
+void ParallelDecompressor::Decompress(DecompressionUnit &unit) {
+	unit.output.clear();
+	try {
+		unit.success = compressed_fs.DecompressFrames(unit.input.data(), unit.input.size(), unit.output);
+	} catch (std::exception &ex) {
+		unit.success = false;
+		unit.error = ErrorData(ex);
+	}
+}
+
+void ParallelDecompressor::WaitForUnit(DecompressionUnit &unit) {
+	unique_lock<mutex> guard(lock);
+	work_finished.wait(guard, [&]() { return unit.finished; });
+}
+
+unique_ptr<DecompressionUnit> ParallelDecompressor::SplitUnit() {
+	idx_t unit_size = 0;
+	while (unit_size < UNIT_SIZE) {
+		idx_t frame_size = 0;
+		if (unit_size < pending.size()) {
+			frame_size = compressed_fs.FindFrameEnd(pending.data() + unit_size, pending.size() - unit_size);
+		}
+		if (frame_size > 0) {
+			unit_size += frame_size;
+			continue;
+		}
+		// the frame does not end within the data that we have read so far
+		if (input_exhausted) {
+			// the remainder of the file is the last unit - decompressing it reports any incomplete frame
+			unit_size = pending.size();
+			break;
+		}
+		if (pending.size() - unit_size >= MAX_FRAME_SEARCH_SIZE) {
+			// we can not find the end of the frame (e.g. because the file consists of a single gzip member or zstd
+			// frame): the remainder of the file is decompressed sequentially once the units before it have been read
+			sequential_fallback = true;
+			fallback_position = pending_start + unit_size;
+			break;
+		}
+		// read more data - doubling the amount we read, as the search for the end of the frame restarts every time
+		auto read_size = MaxValue<idx_t>(UNIT_SIZE, pending.size() - unit_size);
+		auto offset = pending.size();
+		pending.resize(offset + read_size);
+		auto bytes_read = UnsafeNumericCast<idx_t>(child_handle.Read(pending.data() + offset, read_size));
+		pending.resize(offset + bytes_read);
+		if (bytes_read == 0) {
+			input_exhausted = true;
+		}
+	}
+	if (unit_size == 0) {
+		return nullptr;
+	}
+	auto unit = make_uniq<DecompressionUnit>();
+	unit->start = pending_start;
+	unit->input.insert(unit->input.end(), pending.begin(), pending.begin() + NumericCast<int64_t>(unit_size));
+	pending.erase(pending.begin(), pending.begin() + NumericCast<int64_t>(unit_size));
+	pending_start += unit_size;
+	return unit;
+}
+
+void ParallelDecompressor::ScheduleUnits() {
+	while (!sequential_fallback && units.size() < max_units_in_flight) {
+		auto unit = SplitUnit();
+		if (!unit) {
+			break;
+		}
+		{
+			lock_guard<mutex> guard(lock);
+			work_queue.push_back(*unit);
+		}
+		work_available.notify_one();
+		units.push_back(std::move(unit));
+	}
+}
+
+bool ParallelDecompressor::NextUnit() {
+	ScheduleUnits();
+	if (units.empty()) {
+		return false;
+	}
+	auto unit = std::move(units.front());
+	units.pop_front();
+	WaitForUnit(*unit);
+	while (!unit->success) {
+		// the unit did not end at the end of a frame, i.e., we guessed the end of a frame wrong
+		// the start of the unit is correct (as the previous unit was decompressed successfully): merge the unit with
+		// the next one and try again
+		ScheduleUnits();
+		if (units.empty()) {
+			if (sequential_fallback) {
+				// decompress the remainder sequentially, starting at this unit
+				fallback_position = unit->start;
+				return false;
+			}
+			if (unit->error.HasError()) {
+				unit->error.Throw();
+			}
+			throw IOException("Failed to decompress \"%s\": the compressed data ends in an incomplete frame",
+			                  child_handle.GetPath());
+		}
+		auto next_unit = std::move(units.front());
+		units.pop_front();
+		WaitForUnit(*next_unit);
+		unit->input.insert(unit->input.end(), next_unit->input.begin(), next_unit->input.end());
+		Decompress(*unit);
+	}
+	current_unit = std::move(unit);
+	current_offset = 0;
+	return true;
+}
+
+idx_t ParallelDecompressor::Read(data_ptr_t buffer, idx_t nr_bytes) {
+	idx_t total_read = 0;
+	while (total_read < nr_bytes) {
+		if (current_unit && current_offset < current_unit->output.size()) {
+			auto available = MinValue<idx_t>(nr_bytes - total_read, current_unit->output.size() - current_offset);
+			memcpy(buffer + total_read, current_unit->output.data() + current_offset, available);
+			current_offset += available;
+			total_read += available;
+			continue;
+		}
+		current_unit.reset();
+		if (!NextUnit()) {
+			break;
+		}
+	}
+	return total_read;
+}
+
+bool ParallelDecompressor::RequiresSequentialRead(idx_t &position) const {
+	position = fallback_position;
+	return sequential_fallback;
+}
+
 } // namespace duckdb
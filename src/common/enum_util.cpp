@@ -62,6 +62,7 @@
 #include "duckdb/common/multi_file_list.hpp"
 #include "duckdb/common/operator/decimal_cast_operators.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/simd/simd_kernels.hpp"
 #include "duckdb/common/sort/partition_state.hpp"
 #include "duckdb/common/types.hpp"
 #include "duckdb/common/types/column/column_data_scan_states.hpp"
@@ -74,6 +75,7 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/core_functions/aggregate/quantile_enum.hpp"
+#include "duckdb/core_functions/aggregate/sketch_helpers.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_option.hpp"
@@ -4351,6 +4353,12 @@ const char* EnumUtil::ToChars<OptimizerType>(OptimizerType value) {
 		return "COLUMN_LIFETIME";
 	case OptimizerType::TOP_N:
 		return "TOP_N";
+	case OptimizerType::LATE_MATERIALIZATION:
+		return "LATE_MATERIALIZATION";
+	case OptimizerType::QUANTILE_SORT:
+		return "QUANTILE_SORT";
+	case OptimizerType::GROUPING_SETS:
+		return "GROUPING_SETS";
 	case OptimizerType::COMPRESSED_MATERIALIZATION:
 		return "COMPRESSED_MATERIALIZATION";
 	case OptimizerType::DUPLICATE_GROUPS:
@@ -4411,6 +4419,15 @@ OptimizerType EnumUtil::FromString<OptimizerType>(const char *value) {
 	if (StringUtil::Equals(value, "TOP_N")) {
 		return OptimizerType::TOP_N;
 	}
+	if (StringUtil::Equals(value, "LATE_MATERIALIZATION")) {
+		return OptimizerType::LATE_MATERIALIZATION;
+	}
+	if (StringUtil::Equals(value, "QUANTILE_SORT")) {
+		return OptimizerType::QUANTILE_SORT;
+	}
+	if (StringUtil::Equals(value, "GROUPING_SETS")) {
+		return OptimizerType::GROUPING_SETS;
+	}
 	if (StringUtil::Equals(value, "COMPRESSED_MATERIALIZATION")) {
 		return OptimizerType::COMPRESSED_MATERIALIZATION;
 	}
@@ -5750,6 +5767,82 @@ ResultModifierType EnumUtil::FromString<ResultModifierType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<SIMDComparison>(SIMDComparison value) {
+	switch(value) {
+	case SIMDComparison::EQUAL:
+		return "EQUAL";
+	case SIMDComparison::NOT_EQUAL:
+		return "NOT_EQUAL";
+	case SIMDComparison::LESS_THAN:
+		return "LESS_THAN";
+	case SIMDComparison::LESS_THAN_EQUALS:
+		return "LESS_THAN_EQUALS";
+	case SIMDComparison::GREATER_THAN:
+		return "GREATER_THAN";
+	case SIMDComparison::GREATER_THAN_EQUALS:
+		return "GREATER_THAN_EQUALS";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+SIMDComparison EnumUtil::FromString<SIMDComparison>(const char *value) {
+	if (StringUtil::Equals(value, "EQUAL")) {
+		return SIMDComparison::EQUAL;
+	}
+	if (StringUtil::Equals(value, "NOT_EQUAL")) {
+		return SIMDComparison::NOT_EQUAL;
+	}
+	if (StringUtil::Equals(value, "LESS_THAN")) {
+		return SIMDComparison::LESS_THAN;
+	}
+	if (StringUtil::Equals(value, "LESS_THAN_EQUALS")) {
+		return SIMDComparison::LESS_THAN_EQUALS;
+	}
+	if (StringUtil::Equals(value, "GREATER_THAN")) {
+		return SIMDComparison::GREATER_THAN;
+	}
+	if (StringUtil::Equals(value, "GREATER_THAN_EQUALS")) {
+		return SIMDComparison::GREATER_THAN_EQUALS;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<SIMDLevel>(SIMDLevel value) {
+	switch(value) {
+	case SIMDLevel::SCALAR:
+		return "SCALAR";
+	case SIMDLevel::NEON:
+		return "NEON";
+	case SIMDLevel::AVX2:
+		return "AVX2";
+	case SIMDLevel::AVX512:
+		return "AVX512";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+SIMDLevel EnumUtil::FromString<SIMDLevel>(const char *value) {
+	if (StringUtil::Equals(value, "SCALAR")) {
+		return SIMDLevel::SCALAR;
+	}
+	if (StringUtil::Equals(value, "NEON")) {
+		return SIMDLevel::NEON;
+	}
+	if (StringUtil::Equals(value, "AVX2")) {
+		return SIMDLevel::AVX2;
+	}
+	if (StringUtil::Equals(value, "AVX512")) {
+		return SIMDLevel::AVX512;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<SampleMethod>(SampleMethod value) {
 	switch(value) {
@@ -6213,6 +6306,34 @@ SinkResultType EnumUtil::FromString<SinkResultType>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<SketchType>(SketchType value) {
+	switch(value) {
+	case SketchType::HYPERLOGLOG:
+		return "HYPERLOGLOG";
+	case SketchType::TDIGEST:
+		return "TDIGEST";
+	case SketchType::THETA:
+		return "THETA";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+SketchType EnumUtil::FromString<SketchType>(const char *value) {
+	if (StringUtil::Equals(value, "HYPERLOGLOG")) {
+		return SketchType::HYPERLOGLOG;
+	}
+	if (StringUtil::Equals(value, "TDIGEST")) {
+		return SketchType::TDIGEST;
+	}
+	if (StringUtil::Equals(value, "THETA")) {
+		return SketchType::THETA;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<SourceResultType>(SourceResultType value) {
 	switch(value) {
@@ -6782,6 +6903,10 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::JSON_PATH:
+		return "JSON_PATH";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6807,6 +6932,12 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "JSON_PATH")) {
+		return TableFilterType::JSON_PATH;
+	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -7162,6 +7293,8 @@ const char* EnumUtil::ToChars<VectorAuxiliaryDataType>(VectorAuxiliaryDataType v
 	switch(value) {
 	case VectorAuxiliaryDataType::ARROW_AUXILIARY:
 		return "ARROW_AUXILIARY";
+	case VectorAuxiliaryDataType::SHREDDED_JSON:
+		return "SHREDDED_JSON";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -7172,6 +7305,9 @@ VectorAuxiliaryDataType EnumUtil::FromString<VectorAuxiliaryDataType>(const char
 	if (StringUtil::Equals(value, "ARROW_AUXILIARY")) {
 		return VectorAuxiliaryDataType::ARROW_AUXILIARY;
 	}
+	if (StringUtil::Equals(value, "SHREDDED_JSON")) {
+		return VectorAuxiliaryDataType::SHREDDED_JSON;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
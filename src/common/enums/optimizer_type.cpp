@@ -25,6 +25,9 @@ static const DefaultOptimizerType internal_optimizer_types[] = {
     {"common_aggregate", OptimizerType::COMMON_AGGREGATE},
     {"column_lifetime", OptimizerType::COLUMN_LIFETIME},
     {"top_n", OptimizerType::TOP_N},
+    {"late_materialization", OptimizerType::LATE_MATERIALIZATION},
+    {"quantile_sort", OptimizerType::QUANTILE_SORT},
+    {"grouping_sets", OptimizerType::GROUPING_SETS},
     {"compressed_materialization", OptimizerType::COMPRESSED_MATERIALIZATION},
     {"duplicate_groups", OptimizerType::DUPLICATE_GROUPS},
     {"reorder_filter", OptimizerType::REORDER_FILTER},
@@ -537,6 +537,9 @@ unique_ptr<FileHandle> FileSystem::OpenCompressedFile(unique_ptr<FileHandle> han
 	throw NotImplementedException("%s: OpenCompressedFile is not implemented!", GetName());
 }
 
+void FileSystem::SetDecompressionThreads(FileHandle &handle, idx_t threads) {
+}
+
 bool FileSystem::OnDiskFile(FileHandle &handle) {
 	throw NotImplementedException("%s: OnDiskFile is not implemented!", GetName());
 }
@@ -118,7 +118,9 @@ void MiniZStreamWrapper::Initialize(CompressedFile &file, bool write) {
 			throw InternalException("Failed to initialize miniz");
 		}
 	} else {
-		idx_t data_start = GZIP_HEADER_MINSIZE;
+		// the stream does not necessarily start at the beginning of the file, e.g. when decompressing the remainder of
+		// a file that was partially decompressed in parallel
+		idx_t data_start = file.child_handle->SeekPosition() + GZIP_HEADER_MINSIZE;
 		auto read_count = file.child_handle->Read(gzip_hdr, GZIP_HEADER_MINSIZE);
 		GZipFileSystem::VerifyGZIPHeader(gzip_hdr, NumericCast<idx_t>(read_count));
 		// Skip over the extra field if necessary
@@ -402,6 +404,129 @@ string GZipFileSystem::UncompressGZIPString(const char *data, idx_t size) {
 	return decompressed;
 }
 
+//! Returns the size of the header of the gzip member that starts at "data", or 0 if there is no (supported) header
+static idx_t GZipMemberHeaderSize(const_data_ptr_t data, idx_t size) {
+	if (size < GZIP_HEADER_MINSIZE || data[0] != 0x1F || data[1] != 0x8B || data[2] != GZIP_COMPRESSION_DEFLATE) {
+		return 0;
+	}
+	// the flags are validated strictly: we also use this to find the start of the next member in a stream
+	auto flags = data[3];
+	if ((flags & GZIP_FLAG_UNSUPPORTED) || (flags & 0xC0)) {
+		return 0;
+	}
+	idx_t header_size = GZIP_HEADER_MINSIZE;
+	if (flags & GZIP_FLAG_EXTRA) {
+		if (header_size + 2 > size) {
+			return 0;
+		}
+		header_size += 2 + NumericCast<idx_t>(data[header_size] | data[header_size + 1] << 8);
+	}
+	if (flags & GZIP_FLAG_NAME) {
+		while (header_size < size && data[header_size] != '\0') {
+			header_size++;
+		}
+		header_size++;
+	}
+	if (header_size >= size) {
+		return 0;
+	}
+	return header_size;
+}
+
+//! Returns the size of the gzip member that starts at "data" if it is a BGZF block (which stores its size in the
+//! "BC" extra subfield), or 0 otherwise
+static idx_t BGZFBlockSize(const_data_ptr_t data, idx_t size) {
+	static constexpr const idx_t BGZF_HEADER_SIZE = 18;
+	if (size < BGZF_HEADER_SIZE || !(data[3] & GZIP_FLAG_EXTRA)) {
+		return 0;
+	}
+	auto xlen = NumericCast<idx_t>(data[10] | data[11] << 8);
+	if (xlen < 6 || data[12] != 'B' || data[13] != 'C' || data[14] != 2 || data[15] != 0) {
+		return 0;
+	}
+	return NumericCast<idx_t>(data[16] | data[17] << 8) + 1;
+}
+
+bool GZipFileSystem::SupportsParallelDecompression() {
+	return true;
+}
+
+idx_t GZipFileSystem::FindFrameEnd(const_data_ptr_t data, idx_t size) {
+	if (GZipMemberHeaderSize(data, size) == 0) {
+		// not a valid member - the unit will fail to decompress
+		return 0;
+	}
+	auto block_size = BGZFBlockSize(data, size);
+	if (block_size > 0) {
+		return block_size <= size ? block_size : 0;
+	}
+	// the size of a member is not stored, so we look for the start of the next member instead
+	// a gzip header might also occur by chance in the compressed data: if so, decompressing fails and we try again
+	static constexpr const idx_t MIN_MEMBER_SIZE = GZIP_HEADER_MINSIZE + GZIP_FOOTER_SIZE + 2;
+	for (idx_t offset = MIN_MEMBER_SIZE; offset + GZIP_HEADER_MINSIZE <= size; offset++) {
+		auto next = static_cast<const_data_ptr_t>(memchr(data + offset, 0x1F, size - offset));
+		if (!next) {
+			break;
+		}
+		offset = NumericCast<idx_t>(next - data);
+		if (GZipMemberHeaderSize(next, size - offset) > 0) {
+			return offset;
+		}
+	}
+	return 0;
+}
+
+bool GZipFileSystem::DecompressFrames(const_data_ptr_t data, idx_t size, unsafe_vector<data_t> &result) {
+	duckdb_miniz::mz_stream stream;
+	idx_t result_size = result.size();
+	idx_t offset = 0;
+	while (offset < size) {
+		auto header_size = GZipMemberHeaderSize(data + offset, size - offset);
+		if (header_size == 0) {
+			return false;
+		}
+		offset += header_size;
+		memset(&stream, 0, sizeof(duckdb_miniz::mz_stream));
+		if (duckdb_miniz::mz_inflateInit2(&stream, -MZ_DEFAULT_WINDOW_BITS) != duckdb_miniz::MZ_OK) {
+			throw InternalException("Failed to initialize miniz");
+		}
+		auto member_start = result_size;
+		D_ASSERT(size - offset < NumericLimits<uint32_t>::Maximum());
+		stream.next_in = data + offset;
+		stream.avail_in = UnsafeNumericCast<uint32_t>(size - offset);
+		int ret;
+		do {
+			if (result_size == result.size()) {
+				result.resize(MaxValue<idx_t>(result.size() * 2, size * 4));
+			}
+			stream.next_out = result.data() + result_size;
+			stream.avail_out = UnsafeNumericCast<uint32_t>(MinValue<idx_t>(
+			    result.size() - result_size, NumericLimits<uint32_t>::Maximum()));
+			auto avail_out = stream.avail_out;
+			ret = duckdb_miniz::mz_inflate(&stream, duckdb_miniz::MZ_NO_FLUSH);
+			result_size += avail_out - stream.avail_out;
+		} while (ret == duckdb_miniz::MZ_OK);
+		offset = NumericCast<idx_t>(stream.next_in - data);
+		duckdb_miniz::mz_inflateEnd(&stream);
+		if (ret != duckdb_miniz::MZ_STREAM_END || offset + GZIP_FOOTER_SIZE > size) {
+			result.resize(result_size);
+			return false;
+		}
+		// the footer stores the size of the member (modulo 2^32), which verifies that we did not guess the end of the
+		// previous member wrong
+		auto footer = data + offset;
+		auto member_size = NumericCast<idx_t>(footer[4] | footer[5] << 8 | footer[6] << 16) |
+		                   NumericCast<idx_t>(footer[7]) << 24;
+		if (member_size != ((result_size - member_start) & 0xFFFFFFFF)) {
+			result.resize(result_size);
+			return false;
+		}
+		offset += GZIP_FOOTER_SIZE;
+	}
+	result.resize(result_size);
+	return true;
+}
+
 unique_ptr<FileHandle> GZipFileSystem::OpenCompressedFile(unique_ptr<FileHandle> handle, bool write) {
 	auto path = handle->path;
 	return make_uniq<GZipFile>(std::move(handle), path, write);
@@ -0,0 +1,103 @@
+#include "duckdb/common/hardware_counters.hpp"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace duckdb {
+
+HardwareCounterValues HardwareCounterValues::Subtract(const HardwareCounterValues &other) const {
+	HardwareCounterValues result;
+	result.cpu_cycles = cpu_cycles >= other.cpu_cycles ? cpu_cycles - other.cpu_cycles : 0;
+	result.instructions = instructions >= other.instructions ? instructions - other.instructions : 0;
+	result.cache_misses = cache_misses >= other.cache_misses ? cache_misses - other.cache_misses : 0;
+	result.branch_misses = branch_misses >= other.branch_misses ? branch_misses - other.branch_misses : 0;
+	return result;
+}
+
+#if defined(__linux__)
+
+//! The counters of a single thread, which are opened as one group so they can be read with a single system call
+class PerfEventGroup {
+public:
+	static constexpr const idx_t EVENT_COUNT = 4;
+
+	PerfEventGroup() {
+		const uint64_t events[EVENT_COUNT] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		                                      PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+		for (idx_t event_idx = 0; event_idx < EVENT_COUNT; event_idx++) {
+			struct perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = events[event_idx];
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP;
+			// count the calling thread on any CPU, the events that are not supported are left out of the group
+			auto fd = syscall(__NR_perf_event_open, &attr, 0, -1, leader_fd, 0);
+			if (fd < 0) {
+				continue;
+			}
+			if (leader_fd < 0) {
+				leader_fd = int(fd);
+			}
+			fds[event_count] = int(fd);
+			event_indexes[event_count] = event_idx;
+			event_count++;
+		}
+	}
+
+	~PerfEventGroup() {
+		for (idx_t i = 0; i < event_count; i++) {
+			close(fds[i]);
+		}
+	}
+
+	bool Read(HardwareCounterValues &values) {
+		if (leader_fd < 0) {
+			return false;
+		}
+		// the group is read as the number of events, followed by the value of every event
+		uint64_t buffer[1 + EVENT_COUNT];
+		auto bytes = read(leader_fd, buffer, sizeof(buffer));
+		if (bytes < 0 || idx_t(bytes) < sizeof(uint64_t) * (1 + event_count) || buffer[0] != event_count) {
+			return false;
+		}
+		idx_t counts[EVENT_COUNT] = {0, 0, 0, 0};
+		for (idx_t i = 0; i < event_count; i++) {
+			counts[event_indexes[i]] = buffer[1 + i];
+		}
+		values.cpu_cycles = counts[0];
+		values.instructions = counts[1];
+		values.cache_misses = counts[2];
+		values.branch_misses = counts[3];
+		return true;
+	}
+
+private:
+	int leader_fd = -1;
+	idx_t event_count = 0;
+	int fds[EVENT_COUNT];
+	//! The event (in the order of HardwareCounterValues) that every opened counter counts
+	idx_t event_indexes[EVENT_COUNT];
+};
+
+bool HardwareCounters::Read(HardwareCounterValues &values) {
+	// counters can only be read by the thread that they count, so every thread opens its own
+	static thread_local PerfEventGroup group;
+	return group.Read(values);
+}
+
+#else
+
+bool HardwareCounters::Read(HardwareCounterValues &values) {
+	return false;
+}
+
+#endif
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #include "duckdb/function/scalar/string_functions.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/operator_metrics.hpp"
 
 #include <cstdint>
 #include <cstdio>
@@ -115,6 +116,14 @@ bool LocalFileSystem::IsPipe(const string &filename, optional_ptr<FileOpener> op
 }
 #endif
 
+//! Attributes the bytes read to the operator that the calling thread is executing
+static void AddBytesRead(int64_t bytes_read) {
+	auto metrics = OperatorMetrics::Active();
+	if (metrics && bytes_read > 0) {
+		metrics->bytes_read += UnsafeNumericCast<idx_t>(bytes_read);
+	}
+}
+
 #ifndef _WIN32
 // somehow sometimes this is missing
 #ifndef O_CLOEXEC
@@ -430,6 +439,7 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 			    "Could not read enough bytes from file \"%s\": attempted to read %llu bytes from location %llu",
 			    handle.path, nr_bytes, location);
 		}
+		AddBytesRead(bytes_read);
 		read_buffer += bytes_read;
 		nr_bytes -= bytes_read;
 		location += UnsafeNumericCast<idx_t>(bytes_read);
@@ -443,6 +453,7 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 		throw IOException("Could not read from file \"%s\": %s", {{"errno", std::to_string(errno)}}, handle.path,
 		                  strerror(errno));
 	}
+	AddBytesRead(bytes_read);
 	return bytes_read;
 }
 
@@ -872,6 +883,7 @@ static DWORD FSInternalRead(FileHandle &handle, HANDLE hFile, void *buffer, int6
 void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
 	auto bytes_read = FSInternalRead(handle, hFile, buffer, nr_bytes, location);
+	AddBytesRead(bytes_read);
 	if (bytes_read != nr_bytes) {
 		throw IOException("Could not read all bytes from file \"%s\": wanted=%lld read=%lld", handle.path, nr_bytes,
 		                  bytes_read);
@@ -883,6 +895,7 @@ int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
 	auto n = std::min<idx_t>(std::max<idx_t>(GetFileSize(handle), pos) - pos, nr_bytes);
 	auto bytes_read = FSInternalRead(handle, hFile, buffer, n, pos);
+	AddBytesRead(bytes_read);
 	pos += bytes_read;
 	return bytes_read;
 }
@@ -0,0 +1,128 @@
+#include "duckdb/common/simd/simd_kernels.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+namespace duckdb {
+
+constexpr uint64_t SIMDKernels::HASH_MULTIPLIER;
+constexpr uint64_t SIMDKernels::COMBINE_MULTIPLIER;
+
+//===--------------------------------------------------------------------===//
+// Scalar Kernels
+//===--------------------------------------------------------------------===//
+template <class T>
+static void ScalarHash(const T *data, hash_t *result, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		result[i] = MurmurHash64(data[i]);
+	}
+}
+
+template <class T>
+static void ScalarCombineHash(const T *data, hash_t *hashes, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		hashes[i] = (hashes[i] * SIMDKernels::COMBINE_MULTIPLIER) ^ MurmurHash64(data[i]);
+	}
+}
+
+template <class T>
+static idx_t ScalarSelect(const T *data, T constant, SIMDComparison comparison, idx_t count, sel_t *true_sel,
+                          sel_t *false_sel) {
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	SIMDKernels::SelectRemaining<T>(data, constant, comparison, 0, count, true_sel, true_count, false_sel,
+	                                false_count);
+	return true_count;
+}
+
+static idx_t ScalarCountBits(const uint64_t *entries, idx_t entry_count) {
+	idx_t result = 0;
+	for (idx_t i = 0; i < entry_count; i++) {
+		auto entry = entries[i];
+		if (entry == ~uint64_t(0)) {
+			result += 64;
+			continue;
+		}
+		// Kernighan's algorithm
+		while (entry) {
+			entry &= (entry - 1);
+			++result;
+		}
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Byte Matching
+//===--------------------------------------------------------------------===//
+static uint64_t ScalarMatchBytes(const_data_ptr_t data, uint8_t c0, uint8_t c1, uint8_t c2) {
+	uint64_t result = 0;
+	for (idx_t i = 0; i < SIMDKernels::MATCH_BLOCK_SIZE; i++) {
+		const auto c = data[i];
+		result |= uint64_t(c == c0 || c == c1 || c == c2) << i;
+	}
+	return result;
+}
+
+SIMDKernels SIMDKernels::ScalarKernels() {
+	SIMDKernels result;
+	result.level = SIMDLevel::SCALAR;
+	result.hash_uint64 = ScalarHash<uint64_t>;
+	result.hash_uint32 = ScalarHash<uint32_t>;
+	result.combine_hash_uint64 = ScalarCombineHash<uint64_t>;
+	result.combine_hash_uint32 = ScalarCombineHash<uint32_t>;
+	result.select_int32 = ScalarSelect<int32_t>;
+	result.select_int64 = ScalarSelect<int64_t>;
+	result.select_float = ScalarSelect<float>;
+	result.select_double = ScalarSelect<double>;
+	result.count_bits = ScalarCountBits;
+	result.match_bytes = ScalarMatchBytes;
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Dispatch
+//===--------------------------------------------------------------------===//
+vector<SIMDLevel> SIMDKernels::SupportedLevels() {
+	vector<SIMDLevel> result;
+	result.push_back(SIMDLevel::SCALAR);
+#ifdef DUCKDB_SIMD_NEON
+	result.push_back(SIMDLevel::NEON);
+#endif
+#ifdef DUCKDB_SIMD_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi") && __builtin_cpu_supports("popcnt")) {
+		result.push_back(SIMDLevel::AVX2);
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+			result.push_back(SIMDLevel::AVX512);
+		}
+	}
+#endif
+	return result;
+}
+
+SIMDKernels SIMDKernels::GetKernels(SIMDLevel level) {
+	switch (level) {
+	case SIMDLevel::SCALAR:
+		return ScalarKernels();
+#ifdef DUCKDB_SIMD_NEON
+	case SIMDLevel::NEON:
+		return NEONKernels();
+#endif
+#ifdef DUCKDB_SIMD_X86
+	case SIMDLevel::AVX2:
+		return AVX2Kernels();
+	case SIMDLevel::AVX512:
+		return AVX512Kernels();
+#endif
+	default:
+		throw InternalException("SIMD level is not supported by this build");
+	}
+}
+
+const SIMDKernels &SIMDKernels::Get() {
+	static const SIMDKernels kernels = GetKernels(SupportedLevels().back());
+	return kernels;
+}
+
+} // namespace duckdb
@@ -0,0 +1,291 @@
+#include "duckdb/common/simd/simd_kernels.hpp"
+
+#ifdef DUCKDB_SIMD_X86
+
+#include "duckdb/common/types/hash.hpp"
+
+#include <immintrin.h>
+
+namespace duckdb {
+
+#define DUCKDB_TARGET_AVX2 __attribute__((target("avx2,bmi,popcnt")))
+
+//===--------------------------------------------------------------------===//
+// Hashing
+//===--------------------------------------------------------------------===//
+// AVX2 has no 64-bit multiplication: compose it out of 32-bit multiplications (the high half of lo * lo is kept)
+DUCKDB_TARGET_AVX2 static inline __m256i AVX2Multiply(__m256i value, __m256i factor_lo, __m256i factor_hi) {
+	auto lo = _mm256_mul_epu32(value, factor_lo);
+	auto cross =
+	    _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(value, 32), factor_lo), _mm256_mul_epu32(value, factor_hi));
+	return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+
+DUCKDB_TARGET_AVX2 static inline __m256i AVX2MurmurHash(__m256i x, __m256i factor_lo, __m256i factor_hi) {
+	x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+	x = AVX2Multiply(x, factor_lo, factor_hi);
+	x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+	x = AVX2Multiply(x, factor_lo, factor_hi);
+	return _mm256_xor_si256(x, _mm256_srli_epi64(x, 32));
+}
+
+DUCKDB_TARGET_AVX2 static inline __m256i AVX2Load(const uint64_t *data) {
+	return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+}
+
+DUCKDB_TARGET_AVX2 static inline __m256i AVX2Load(const uint32_t *data) {
+	// zero-extend to 64-bit, like MurmurHash32
+	return _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)));
+}
+
+template <class T>
+DUCKDB_TARGET_AVX2 static void AVX2Hash(const T *data, hash_t *result, idx_t count) {
+	const auto hash_lo = _mm256_set1_epi64x(int64_t(SIMDKernels::HASH_MULTIPLIER & 0xFFFFFFFF));
+	const auto hash_hi = _mm256_set1_epi64x(int64_t(SIMDKernels::HASH_MULTIPLIER >> 32));
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		auto hash = AVX2MurmurHash(AVX2Load(data + i), hash_lo, hash_hi);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(result + i), hash);
+	}
+	for (; i < count; i++) {
+		result[i] = MurmurHash64(data[i]);
+	}
+}
+
+template <class T>
+DUCKDB_TARGET_AVX2 static void AVX2CombineHash(const T *data, hash_t *hashes, idx_t count) {
+	const auto hash_lo = _mm256_set1_epi64x(int64_t(SIMDKernels::HASH_MULTIPLIER & 0xFFFFFFFF));
+	const auto hash_hi = _mm256_set1_epi64x(int64_t(SIMDKernels::HASH_MULTIPLIER >> 32));
+	const auto combine_lo = _mm256_set1_epi64x(int64_t(SIMDKernels::COMBINE_MULTIPLIER & 0xFFFFFFFF));
+	const auto combine_hi = _mm256_set1_epi64x(int64_t(SIMDKernels::COMBINE_MULTIPLIER >> 32));
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		auto hash = AVX2MurmurHash(AVX2Load(data + i), hash_lo, hash_hi);
+		auto current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(hashes + i));
+		auto combined = _mm256_xor_si256(AVX2Multiply(current, combine_lo, combine_hi), hash);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(hashes + i), combined);
+	}
+	for (; i < count; i++) {
+		hashes[i] = (hashes[i] * SIMDKernels::COMBINE_MULTIPLIER) ^ MurmurHash64(data[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Selection
+//===--------------------------------------------------------------------===//
+//! For every 8-bit mask, the positions of the set bits packed into 4-bit nibbles
+struct AVX2CompressTable {
+	AVX2CompressTable() {
+		for (uint32_t mask = 0; mask < 256; mask++) {
+			uint32_t packed = 0;
+			uint32_t position = 0;
+			for (uint32_t bit = 0; bit < 8; bit++) {
+				if (mask & (1U << bit)) {
+					packed |= bit << (4 * position++);
+				}
+			}
+			entries[mask] = packed;
+		}
+	}
+
+	uint32_t entries[256];
+};
+
+static const uint32_t *AVX2GetCompressTable() {
+	static const AVX2CompressTable table;
+	return table.entries;
+}
+
+//! Writes the indices for which the mask is set to sel[count..], always storing 8 entries. This never writes past
+//! the end of the selection: count <= the offset of the current 8 rows, which are all within the input
+DUCKDB_TARGET_AVX2 static inline void AVX2Compress(uint32_t mask, __m256i indices, const uint32_t *table, sel_t *sel,
+                                                   idx_t &count) {
+	const auto shifts = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+	auto permutation = _mm256_and_si256(_mm256_srlv_epi32(_mm256_set1_epi32(int32_t(table[mask])), shifts),
+	                                    _mm256_set1_epi32(0xF));
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(sel + count), _mm256_permutevar8x32_epi32(indices, permutation));
+	count += UnsafeNumericCast<idx_t>(_mm_popcnt_u32(mask));
+}
+
+//! Computes the comparison mask of 8 rows. The comparisons are expressed as (optionally inverted) equality,
+//! greater than and less than
+template <SIMDComparison COMPARISON>
+struct AVX2IntegerCompare {
+	static constexpr bool INVERT = COMPARISON == SIMDComparison::NOT_EQUAL ||
+	                               COMPARISON == SIMDComparison::LESS_THAN_EQUALS ||
+	                               COMPARISON == SIMDComparison::GREATER_THAN_EQUALS;
+
+	DUCKDB_TARGET_AVX2 static inline __m256i Compare32(__m256i left, __m256i right) {
+		switch (COMPARISON) {
+		case SIMDComparison::EQUAL:
+		case SIMDComparison::NOT_EQUAL:
+			return _mm256_cmpeq_epi32(left, right);
+		case SIMDComparison::GREATER_THAN:
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return _mm256_cmpgt_epi32(left, right);
+		default:
+			return _mm256_cmpgt_epi32(right, left);
+		}
+	}
+
+	DUCKDB_TARGET_AVX2 static inline __m256i Compare64(__m256i left, __m256i right) {
+		switch (COMPARISON) {
+		case SIMDComparison::EQUAL:
+		case SIMDComparison::NOT_EQUAL:
+			return _mm256_cmpeq_epi64(left, right);
+		case SIMDComparison::GREATER_THAN:
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return _mm256_cmpgt_epi64(left, right);
+		default:
+			return _mm256_cmpgt_epi64(right, left);
+		}
+	}
+
+	DUCKDB_TARGET_AVX2 static inline uint32_t Mask(const int32_t *data, int32_t constant) {
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+		auto result = uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(Compare32(values, _mm256_set1_epi32(constant)))));
+		return INVERT ? result ^ 0xFF : result;
+	}
+
+	DUCKDB_TARGET_AVX2 static inline uint32_t Mask(const int64_t *data, int64_t constant) {
+		auto right = _mm256_set1_epi64x(constant);
+		auto first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+		auto second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + 4));
+		auto result = uint32_t(_mm256_movemask_pd(_mm256_castsi256_pd(Compare64(first, right)))) |
+		              uint32_t(_mm256_movemask_pd(_mm256_castsi256_pd(Compare64(second, right)))) << 4;
+		return INVERT ? result ^ 0xFF : result;
+	}
+};
+
+//! NaN is greater than any other value: the unordered predicates are used for (not) equals and greater than
+template <SIMDComparison COMPARISON>
+struct AVX2FloatCompare {
+	static constexpr int PREDICATE = COMPARISON == SIMDComparison::EQUAL              ? _CMP_EQ_OQ
+	                                 : COMPARISON == SIMDComparison::NOT_EQUAL        ? _CMP_NEQ_UQ
+	                                 : COMPARISON == SIMDComparison::LESS_THAN        ? _CMP_LT_OQ
+	                                 : COMPARISON == SIMDComparison::LESS_THAN_EQUALS ? _CMP_LE_OQ
+	                                 : COMPARISON == SIMDComparison::GREATER_THAN     ? _CMP_NLE_UQ
+	                                                                                  : _CMP_NLT_UQ;
+
+	DUCKDB_TARGET_AVX2 static inline uint32_t Mask(const float *data, float constant) {
+		auto values = _mm256_loadu_ps(data);
+		return uint32_t(_mm256_movemask_ps(_mm256_cmp_ps(values, _mm256_set1_ps(constant), PREDICATE)));
+	}
+
+	DUCKDB_TARGET_AVX2 static inline uint32_t Mask(const double *data, double constant) {
+		auto right = _mm256_set1_pd(constant);
+		auto first = _mm256_cmp_pd(_mm256_loadu_pd(data), right, PREDICATE);
+		auto second = _mm256_cmp_pd(_mm256_loadu_pd(data + 4), right, PREDICATE);
+		return uint32_t(_mm256_movemask_pd(first)) | uint32_t(_mm256_movemask_pd(second)) << 4;
+	}
+};
+
+template <class T, class OP>
+DUCKDB_TARGET_AVX2 static idx_t AVX2SelectLoop(const T *data, T constant, SIMDComparison comparison, idx_t count,
+                                                sel_t *true_sel, sel_t *false_sel) {
+	const auto table = AVX2GetCompressTable();
+	const auto lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	idx_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const auto mask = OP::Mask(data + i, constant);
+		const auto indices = _mm256_add_epi32(_mm256_set1_epi32(int32_t(i)), lanes);
+		if (true_sel) {
+			AVX2Compress(mask, indices, table, true_sel, true_count);
+		} else {
+			true_count += UnsafeNumericCast<idx_t>(_mm_popcnt_u32(mask));
+		}
+		if (false_sel) {
+			AVX2Compress(mask ^ 0xFF, indices, table, false_sel, false_count);
+		}
+	}
+	SIMDKernels::SelectRemaining<T>(data, constant, comparison, i, count, true_sel, true_count, false_sel,
+	                                false_count);
+	return true_count;
+}
+
+template <class T, template <SIMDComparison> class OP>
+static idx_t AVX2Select(const T *data, T constant, SIMDComparison comparison, idx_t count, sel_t *true_sel,
+                        sel_t *false_sel) {
+	switch (comparison) {
+	case SIMDComparison::EQUAL:
+		return AVX2SelectLoop<T, OP<SIMDComparison::EQUAL>>(data, constant, comparison, count, true_sel, false_sel);
+	case SIMDComparison::NOT_EQUAL:
+		return AVX2SelectLoop<T, OP<SIMDComparison::NOT_EQUAL>>(data, constant, comparison, count, true_sel,
+		                                                        false_sel);
+	case SIMDComparison::LESS_THAN:
+		return AVX2SelectLoop<T, OP<SIMDComparison::LESS_THAN>>(data, constant, comparison, count, true_sel,
+		                                                        false_sel);
+	case SIMDComparison::LESS_THAN_EQUALS:
+		return AVX2SelectLoop<T, OP<SIMDComparison::LESS_THAN_EQUALS>>(data, constant, comparison, count, true_sel,
+		                                                               false_sel);
+	case SIMDComparison::GREATER_THAN:
+		return AVX2SelectLoop<T, OP<SIMDComparison::GREATER_THAN>>(data, constant, comparison, count, true_sel,
+		                                                           false_sel);
+	default:
+		return AVX2SelectLoop<T, OP<SIMDComparison::GREATER_THAN_EQUALS>>(data, constant, comparison, count,
+		                                                                  true_sel, false_sel);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Validity
+//===--------------------------------------------------------------------===//
+// Counts the bits of 4 entries at a time with a nibble lookup table (Mula et al.)
+DUCKDB_TARGET_AVX2 static idx_t AVX2CountBits(const uint64_t *entries, idx_t entry_count) {
+	const auto lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2,
+	                                     2, 3, 2, 3, 3, 4);
+	const auto low_mask = _mm256_set1_epi8(0x0F);
+	auto total = _mm256_setzero_si256();
+	idx_t i = 0;
+	for (; i + 4 <= entry_count; i += 4) {
+		auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(entries + i));
+		auto low = _mm256_shuffle_epi8(lookup, _mm256_and_si256(values, low_mask));
+		auto high = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(values, 4), low_mask));
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), _mm256_setzero_si256()));
+	}
+	idx_t result = UnsafeNumericCast<idx_t>(_mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1) +
+	                                        _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3));
+	for (; i < entry_count; i++) {
+		result += UnsafeNumericCast<idx_t>(_mm_popcnt_u64(entries[i]));
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Byte Matching
+//===--------------------------------------------------------------------===//
+DUCKDB_TARGET_AVX2 static inline uint64_t AVX2MatchBytes(const_data_ptr_t data, __m256i c0, __m256i c1, __m256i c2) {
+	auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data));
+	auto match = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(bytes, c0), _mm256_cmpeq_epi8(bytes, c1)),
+	                             _mm256_cmpeq_epi8(bytes, c2));
+	return uint32_t(_mm256_movemask_epi8(match));
+}
+
+DUCKDB_TARGET_AVX2 static uint64_t AVX2MatchBytesBlock(const_data_ptr_t data, uint8_t c0, uint8_t c1, uint8_t c2) {
+	const auto v0 = _mm256_set1_epi8(static_cast<char>(c0));
+	const auto v1 = _mm256_set1_epi8(static_cast<char>(c1));
+	const auto v2 = _mm256_set1_epi8(static_cast<char>(c2));
+	return AVX2MatchBytes(data, v0, v1, v2) | AVX2MatchBytes(data + 32, v0, v1, v2) << 32;
+}
+
+SIMDKernels SIMDKernels::AVX2Kernels() {
+	SIMDKernels result;
+	result.level = SIMDLevel::AVX2;
+	result.hash_uint64 = AVX2Hash<uint64_t>;
+	result.hash_uint32 = AVX2Hash<uint32_t>;
+	result.combine_hash_uint64 = AVX2CombineHash<uint64_t>;
+	result.combine_hash_uint32 = AVX2CombineHash<uint32_t>;
+	result.select_int32 = AVX2Select<int32_t, AVX2IntegerCompare>;
+	result.select_int64 = AVX2Select<int64_t, AVX2IntegerCompare>;
+	result.select_float = AVX2Select<float, AVX2FloatCompare>;
+	result.select_double = AVX2Select<double, AVX2FloatCompare>;
+	result.count_bits = AVX2CountBits;
+	result.match_bytes = AVX2MatchBytesBlock;
+	return result;
+}
+
+} // namespace duckdb
+
+#endif
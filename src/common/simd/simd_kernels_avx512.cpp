@@ -0,0 +1,185 @@
+#include "duckdb/common/simd/simd_kernels.hpp"
+
+#ifdef DUCKDB_SIMD_X86
+
+#include "duckdb/common/types/hash.hpp"
+
+#include <immintrin.h>
+
+namespace duckdb {
+
+#define DUCKDB_TARGET_AVX512 __attribute__((target("avx512f,avx512dq,avx2,bmi,popcnt")))
+#define DUCKDB_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+
+//===--------------------------------------------------------------------===//
+// Hashing
+//===--------------------------------------------------------------------===//
+DUCKDB_TARGET_AVX512 static inline __m512i AVX512MurmurHash(__m512i x, __m512i factor) {
+	x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+	x = _mm512_mullo_epi64(x, factor);
+	x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+	x = _mm512_mullo_epi64(x, factor);
+	return _mm512_xor_si512(x, _mm512_srli_epi64(x, 32));
+}
+
+DUCKDB_TARGET_AVX512 static inline __m512i AVX512Load(const uint64_t *data) {
+	return _mm512_loadu_si512(data);
+}
+
+DUCKDB_TARGET_AVX512 static inline __m512i AVX512Load(const uint32_t *data) {
+	// zero-extend to 64-bit, like MurmurHash32
+	return _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)));
+}
+
+template <class T>
+DUCKDB_TARGET_AVX512 static void AVX512Hash(const T *data, hash_t *result, idx_t count) {
+	const auto factor = _mm512_set1_epi64(int64_t(SIMDKernels::HASH_MULTIPLIER));
+	idx_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm512_storeu_si512(result + i, AVX512MurmurHash(AVX512Load(data + i), factor));
+	}
+	for (; i < count; i++) {
+		result[i] = MurmurHash64(data[i]);
+	}
+}
+
+template <class T>
+DUCKDB_TARGET_AVX512 static void AVX512CombineHash(const T *data, hash_t *hashes, idx_t count) {
+	const auto factor = _mm512_set1_epi64(int64_t(SIMDKernels::HASH_MULTIPLIER));
+	const auto combine = _mm512_set1_epi64(int64_t(SIMDKernels::COMBINE_MULTIPLIER));
+	idx_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto hash = AVX512MurmurHash(AVX512Load(data + i), factor);
+		auto current = _mm512_loadu_si512(hashes + i);
+		_mm512_storeu_si512(hashes + i, _mm512_xor_si512(_mm512_mullo_epi64(current, combine), hash));
+	}
+	for (; i < count; i++) {
+		hashes[i] = (hashes[i] * SIMDKernels::COMBINE_MULTIPLIER) ^ MurmurHash64(data[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Selection
+//===--------------------------------------------------------------------===//
+//! Computes the comparison mask of 16 rows. NaN is greater than any other value: the unordered predicates are used
+//! for floating point (not) equals and greater than
+template <SIMDComparison COMPARISON>
+struct AVX512Compare {
+	static constexpr int INTEGER_PREDICATE = COMPARISON == SIMDComparison::EQUAL              ? _MM_CMPINT_EQ
+	                                         : COMPARISON == SIMDComparison::NOT_EQUAL        ? _MM_CMPINT_NE
+	                                         : COMPARISON == SIMDComparison::LESS_THAN        ? _MM_CMPINT_LT
+	                                         : COMPARISON == SIMDComparison::LESS_THAN_EQUALS ? _MM_CMPINT_LE
+	                                         : COMPARISON == SIMDComparison::GREATER_THAN     ? _MM_CMPINT_NLE
+	                                                                                          : _MM_CMPINT_NLT;
+	static constexpr int FLOAT_PREDICATE = COMPARISON == SIMDComparison::EQUAL              ? _CMP_EQ_OQ
+	                                       : COMPARISON == SIMDComparison::NOT_EQUAL        ? _CMP_NEQ_UQ
+	                                       : COMPARISON == SIMDComparison::LESS_THAN        ? _CMP_LT_OQ
+	                                       : COMPARISON == SIMDComparison::LESS_THAN_EQUALS ? _CMP_LE_OQ
+	                                       : COMPARISON == SIMDComparison::GREATER_THAN     ? _CMP_NLE_UQ
+	                                                                                        : _CMP_NLT_UQ;
+
+	DUCKDB_TARGET_AVX512 static inline __mmask16 Mask(const int32_t *data, int32_t constant) {
+		return _mm512_cmp_epi32_mask(_mm512_loadu_si512(data), _mm512_set1_epi32(constant), INTEGER_PREDICATE);
+	}
+
+	DUCKDB_TARGET_AVX512 static inline __mmask16 Mask(const int64_t *data, int64_t constant) {
+		auto right = _mm512_set1_epi64(constant);
+		auto first = _mm512_cmp_epi64_mask(_mm512_loadu_si512(data), right, INTEGER_PREDICATE);
+		auto second = _mm512_cmp_epi64_mask(_mm512_loadu_si512(data + 8), right, INTEGER_PREDICATE);
+		return __mmask16(uint32_t(first) | uint32_t(second) << 8);
+	}
+
+	DUCKDB_TARGET_AVX512 static inline __mmask16 Mask(const float *data, float constant) {
+		return _mm512_cmp_ps_mask(_mm512_loadu_ps(data), _mm512_set1_ps(constant), FLOAT_PREDICATE);
+	}
+
+	DUCKDB_TARGET_AVX512 static inline __mmask16 Mask(const double *data, double constant) {
+		auto right = _mm512_set1_pd(constant);
+		auto first = _mm512_cmp_pd_mask(_mm512_loadu_pd(data), right, FLOAT_PREDICATE);
+		auto second = _mm512_cmp_pd_mask(_mm512_loadu_pd(data + 8), right, FLOAT_PREDICATE);
+		return __mmask16(uint32_t(first) | uint32_t(second) << 8);
+	}
+};
+
+template <class T, class OP>
+DUCKDB_TARGET_AVX512 static idx_t AVX512SelectLoop(const T *data, T constant, SIMDComparison comparison, idx_t count,
+                                                    sel_t *true_sel, sel_t *false_sel) {
+	const auto lanes = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	idx_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		const auto mask = OP::Mask(data + i, constant);
+		const auto matches = UnsafeNumericCast<idx_t>(_mm_popcnt_u32(uint32_t(mask)));
+		const auto indices = _mm512_add_epi32(_mm512_set1_epi32(int32_t(i)), lanes);
+		if (true_sel) {
+			_mm512_mask_compressstoreu_epi32(true_sel + true_count, mask, indices);
+		}
+		if (false_sel) {
+			_mm512_mask_compressstoreu_epi32(false_sel + false_count, __mmask16(~uint32_t(mask)), indices);
+		}
+		true_count += matches;
+		false_count += 16 - matches;
+	}
+	SIMDKernels::SelectRemaining<T>(data, constant, comparison, i, count, true_sel, true_count, false_sel,
+	                                false_count);
+	return true_count;
+}
+
+template <class T>
+static idx_t AVX512Select(const T *data, T constant, SIMDComparison comparison, idx_t count, sel_t *true_sel,
+                          sel_t *false_sel) {
+	switch (comparison) {
+	case SIMDComparison::EQUAL:
+		return AVX512SelectLoop<T, AVX512Compare<SIMDComparison::EQUAL>>(data, constant, comparison, count, true_sel,
+		                                                                 false_sel);
+	case SIMDComparison::NOT_EQUAL:
+		return AVX512SelectLoop<T, AVX512Compare<SIMDComparison::NOT_EQUAL>>(data, constant, comparison, count,
+		                                                                     true_sel, false_sel);
+	case SIMDComparison::LESS_THAN:
+		return AVX512SelectLoop<T, AVX512Compare<SIMDComparison::LESS_THAN>>(data, constant, comparison, count,
+		                                                                     true_sel, false_sel);
+	case SIMDComparison::LESS_THAN_EQUALS:
+		return AVX512SelectLoop<T, AVX512Compare<SIMDComparison::LESS_THAN_EQUALS>>(data, constant, comparison, count,
+		                                                                            true_sel, false_sel);
+	case SIMDComparison::GREATER_THAN:
+		return AVX512SelectLoop<T, AVX512Compare<SIMDComparison::GREATER_THAN>>(data, constant, comparison, count,
+		                                                                        true_sel, false_sel);
+	default:
+		return AVX512SelectLoop<T, AVX512Compare<SIMDComparison::GREATER_THAN_EQUALS>>(data, constant, comparison,
+		                                                                               count, true_sel, false_sel);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Byte Matching
+//===--------------------------------------------------------------------===//
+DUCKDB_TARGET_AVX512BW static uint64_t AVX512MatchBytes(const_data_ptr_t data, uint8_t c0, uint8_t c1, uint8_t c2) {
+	auto bytes = _mm512_loadu_si512(data);
+	return _mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(static_cast<char>(c0))) |
+	       _mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(static_cast<char>(c1))) |
+	       _mm512_cmpeq_epi8_mask(bytes, _mm512_set1_epi8(static_cast<char>(c2)));
+}
+
+SIMDKernels SIMDKernels::AVX512Kernels() {
+	// the bit counting kernel of AVX2 is used, as VPOPCNTDQ is not available on all AVX-512 CPUs
+	// the same holds for AVX512BW, without it the byte matching kernel of AVX2 is used
+	auto result = AVX2Kernels();
+	result.level = SIMDLevel::AVX512;
+	result.hash_uint64 = AVX512Hash<uint64_t>;
+	result.hash_uint32 = AVX512Hash<uint32_t>;
+	result.combine_hash_uint64 = AVX512CombineHash<uint64_t>;
+	result.combine_hash_uint32 = AVX512CombineHash<uint32_t>;
+	result.select_int32 = AVX512Select<int32_t>;
+	result.select_int64 = AVX512Select<int64_t>;
+	result.select_float = AVX512Select<float>;
+	result.select_double = AVX512Select<double>;
+	if (__builtin_cpu_supports("avx512bw")) {
+		result.match_bytes = AVX512MatchBytes;
+	}
+	return result;
+}
+
+} // namespace duckdb
+
+#endif
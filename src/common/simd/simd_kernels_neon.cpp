@@ -0,0 +1,282 @@
+#include "duckdb/common/simd/simd_kernels.hpp"
+
+#ifdef DUCKDB_SIMD_NEON
+
+#include "duckdb/common/types/hash.hpp"
+
+#include <arm_neon.h>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Hashing
+//===--------------------------------------------------------------------===//
+// NEON has no 64-bit multiplication: compose it out of widening 32-bit multiplications
+static inline uint64x2_t NEONMultiply(uint64x2_t value, uint32x2_t factor_lo, uint32x2_t factor_hi) {
+	auto value_lo = vmovn_u64(value);
+	auto value_hi = vshrn_n_u64(value, 32);
+	auto cross = vaddq_u64(vmull_u32(value_hi, factor_lo), vmull_u32(value_lo, factor_hi));
+	return vaddq_u64(vmull_u32(value_lo, factor_lo), vshlq_n_u64(cross, 32));
+}
+
+static inline uint64x2_t NEONMurmurHash(uint64x2_t x, uint32x2_t factor_lo, uint32x2_t factor_hi) {
+	x = veorq_u64(x, vshrq_n_u64(x, 32));
+	x = NEONMultiply(x, factor_lo, factor_hi);
+	x = veorq_u64(x, vshrq_n_u64(x, 32));
+	x = NEONMultiply(x, factor_lo, factor_hi);
+	return veorq_u64(x, vshrq_n_u64(x, 32));
+}
+
+static inline uint64x2_t NEONLoad(const uint64_t *data) {
+	return vld1q_u64(data);
+}
+
+static inline uint64x2_t NEONLoad(const uint32_t *data) {
+	// zero-extend to 64-bit, like MurmurHash32
+	return vmovl_u32(vld1_u32(data));
+}
+
+template <class T>
+static void NEONHash(const T *data, hash_t *result, idx_t count) {
+	const auto hash_lo = vdup_n_u32(uint32_t(SIMDKernels::HASH_MULTIPLIER & 0xFFFFFFFF));
+	const auto hash_hi = vdup_n_u32(uint32_t(SIMDKernels::HASH_MULTIPLIER >> 32));
+	idx_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		vst1q_u64(result + i, NEONMurmurHash(NEONLoad(data + i), hash_lo, hash_hi));
+	}
+	for (; i < count; i++) {
+		result[i] = MurmurHash64(data[i]);
+	}
+}
+
+template <class T>
+static void NEONCombineHash(const T *data, hash_t *hashes, idx_t count) {
+	const auto hash_lo = vdup_n_u32(uint32_t(SIMDKernels::HASH_MULTIPLIER & 0xFFFFFFFF));
+	const auto hash_hi = vdup_n_u32(uint32_t(SIMDKernels::HASH_MULTIPLIER >> 32));
+	const auto combine_lo = vdup_n_u32(uint32_t(SIMDKernels::COMBINE_MULTIPLIER & 0xFFFFFFFF));
+	const auto combine_hi = vdup_n_u32(uint32_t(SIMDKernels::COMBINE_MULTIPLIER >> 32));
+	idx_t i = 0;
+	for (; i + 2 <= count; i += 2) {
+		auto hash = NEONMurmurHash(NEONLoad(data + i), hash_lo, hash_hi);
+		auto current = vld1q_u64(hashes + i);
+		vst1q_u64(hashes + i, veorq_u64(NEONMultiply(current, combine_lo, combine_hi), hash));
+	}
+	for (; i < count; i++) {
+		hashes[i] = (hashes[i] * SIMDKernels::COMBINE_MULTIPLIER) ^ MurmurHash64(data[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Selection
+//===--------------------------------------------------------------------===//
+static inline uint32_t NEONMovemask(uint32x4_t compare) {
+	static const uint32_t BITS[] = {1, 2, 4, 8};
+	return vaddvq_u32(vandq_u32(compare, vld1q_u32(BITS)));
+}
+
+static inline uint32_t NEONMovemask(uint64x2_t first, uint64x2_t second) {
+	static const uint64_t BITS[] = {1, 2};
+	auto bits = vld1q_u64(BITS);
+	return uint32_t(vaddvq_u64(vandq_u64(first, bits)) | vaddvq_u64(vandq_u64(second, bits)) << 2);
+}
+
+//! Computes the comparison mask of 4 rows. NaN is greater than any other value, which the (ordered) NEON
+//! comparisons do not take into account for greater than
+template <SIMDComparison COMPARISON>
+struct NEONCompare {
+	static inline uint32x4_t Compare(int32x4_t left, int32x4_t right) {
+		switch (COMPARISON) {
+		case SIMDComparison::EQUAL:
+		case SIMDComparison::NOT_EQUAL:
+			return vceqq_s32(left, right);
+		case SIMDComparison::LESS_THAN:
+			return vcltq_s32(left, right);
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return vcleq_s32(left, right);
+		case SIMDComparison::GREATER_THAN:
+			return vcgtq_s32(left, right);
+		default:
+			return vcgeq_s32(left, right);
+		}
+	}
+
+	static inline uint64x2_t Compare(int64x2_t left, int64x2_t right) {
+		switch (COMPARISON) {
+		case SIMDComparison::EQUAL:
+		case SIMDComparison::NOT_EQUAL:
+			return vceqq_s64(left, right);
+		case SIMDComparison::LESS_THAN:
+			return vcltq_s64(left, right);
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return vcleq_s64(left, right);
+		case SIMDComparison::GREATER_THAN:
+			return vcgtq_s64(left, right);
+		default:
+			return vcgeq_s64(left, right);
+		}
+	}
+
+	static inline uint32x4_t Compare(float32x4_t left, float32x4_t right) {
+		switch (COMPARISON) {
+		case SIMDComparison::EQUAL:
+		case SIMDComparison::NOT_EQUAL:
+			return vceqq_f32(left, right);
+		case SIMDComparison::LESS_THAN:
+			return vcltq_f32(left, right);
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return vcleq_f32(left, right);
+		case SIMDComparison::GREATER_THAN:
+			return vorrq_u32(vcgtq_f32(left, right), vmvnq_u32(vceqq_f32(left, left)));
+		default:
+			return vorrq_u32(vcgeq_f32(left, right), vmvnq_u32(vceqq_f32(left, left)));
+		}
+	}
+
+	static inline uint64x2_t Compare(float64x2_t left, float64x2_t right) {
+		const auto all_set = vdupq_n_u64(~uint64_t(0));
+		switch (COMPARISON) {
+		case SIMDComparison::EQUAL:
+		case SIMDComparison::NOT_EQUAL:
+			return vceqq_f64(left, right);
+		case SIMDComparison::LESS_THAN:
+			return vcltq_f64(left, right);
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return vcleq_f64(left, right);
+		case SIMDComparison::GREATER_THAN:
+			return vorrq_u64(vcgtq_f64(left, right), veorq_u64(vceqq_f64(left, left), all_set));
+		default:
+			return vorrq_u64(vcgeq_f64(left, right), veorq_u64(vceqq_f64(left, left), all_set));
+		}
+	}
+
+	//! Not equals is computed as inverted equals
+	static inline uint32_t Invert(uint32_t mask) {
+		return COMPARISON == SIMDComparison::NOT_EQUAL ? mask ^ 0xF : mask;
+	}
+
+	static inline uint32_t Mask(const int32_t *data, int32_t constant) {
+		return Invert(NEONMovemask(Compare(vld1q_s32(data), vdupq_n_s32(constant))));
+	}
+
+	static inline uint32_t Mask(const int64_t *data, int64_t constant) {
+		auto right = vdupq_n_s64(constant);
+		return Invert(NEONMovemask(Compare(vld1q_s64(data), right), Compare(vld1q_s64(data + 2), right)));
+	}
+
+	static inline uint32_t Mask(const float *data, float constant) {
+		return Invert(NEONMovemask(Compare(vld1q_f32(data), vdupq_n_f32(constant))));
+	}
+
+	static inline uint32_t Mask(const double *data, double constant) {
+		auto right = vdupq_n_f64(constant);
+		return Invert(NEONMovemask(Compare(vld1q_f64(data), right), Compare(vld1q_f64(data + 2), right)));
+	}
+};
+
+template <class T, class OP>
+static idx_t NEONSelectLoop(const T *data, T constant, SIMDComparison comparison, idx_t count, sel_t *true_sel,
+                            sel_t *false_sel) {
+	idx_t true_count = 0;
+	idx_t false_count = 0;
+	idx_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		const auto mask = OP::Mask(data + i, constant);
+		for (idx_t lane = 0; lane < 4; lane++) {
+			const auto match = (mask >> lane) & 1;
+			if (true_sel) {
+				true_sel[true_count] = UnsafeNumericCast<sel_t>(i + lane);
+			}
+			if (false_sel) {
+				false_sel[false_count] = UnsafeNumericCast<sel_t>(i + lane);
+			}
+			true_count += match;
+			false_count += 1 - match;
+		}
+	}
+	SIMDKernels::SelectRemaining<T>(data, constant, comparison, i, count, true_sel, true_count, false_sel,
+	                                false_count);
+	return true_count;
+}
+
+template <class T>
+static idx_t NEONSelect(const T *data, T constant, SIMDComparison comparison, idx_t count, sel_t *true_sel,
+                        sel_t *false_sel) {
+	switch (comparison) {
+	case SIMDComparison::EQUAL:
+		return NEONSelectLoop<T, NEONCompare<SIMDComparison::EQUAL>>(data, constant, comparison, count, true_sel,
+		                                                             false_sel);
+	case SIMDComparison::NOT_EQUAL:
+		return NEONSelectLoop<T, NEONCompare<SIMDComparison::NOT_EQUAL>>(data, constant, comparison, count, true_sel,
+		                                                                 false_sel);
+	case SIMDComparison::LESS_THAN:
+		return NEONSelectLoop<T, NEONCompare<SIMDComparison::LESS_THAN>>(data, constant, comparison, count, true_sel,
+		                                                                 false_sel);
+	case SIMDComparison::LESS_THAN_EQUALS:
+		return NEONSelectLoop<T, NEONCompare<SIMDComparison::LESS_THAN_EQUALS>>(data, constant, comparison, count,
+		                                                                        true_sel, false_sel);
+	case SIMDComparison::GREATER_THAN:
+		return NEONSelectLoop<T, NEONCompare<SIMDComparison::GREATER_THAN>>(data, constant, comparison, count,
+		                                                                    true_sel, false_sel);
+	default:
+		return NEONSelectLoop<T, NEONCompare<SIMDComparison::GREATER_THAN_EQUALS>>(data, constant, comparison, count,
+		                                                                           true_sel, false_sel);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Validity
+//===--------------------------------------------------------------------===//
+static idx_t NEONCountBits(const uint64_t *entries, idx_t entry_count) {
+	idx_t result = 0;
+	idx_t i = 0;
+	for (; i + 2 <= entry_count; i += 2) {
+		auto bytes = vcntq_u8(vreinterpretq_u8_u64(vld1q_u64(entries + i)));
+		result += vaddlvq_u8(bytes);
+	}
+	for (; i < entry_count; i++) {
+		result += vaddv_u8(vcnt_u8(vcreate_u8(entries[i])));
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Byte Matching
+//===--------------------------------------------------------------------===//
+static uint64_t NEONMatchBytes(const_data_ptr_t data, uint8_t c0, uint8_t c1, uint8_t c2) {
+	static const uint8_t BITS[] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+	const auto bits = vld1q_u8(BITS);
+	const auto v0 = vdupq_n_u8(c0);
+	const auto v1 = vdupq_n_u8(c1);
+	const auto v2 = vdupq_n_u8(c2);
+	uint64_t result = 0;
+	for (idx_t i = 0; i < SIMDKernels::MATCH_BLOCK_SIZE; i += 16) {
+		auto bytes = vld1q_u8(data + i);
+		auto match = vorrq_u8(vorrq_u8(vceqq_u8(bytes, v0), vceqq_u8(bytes, v1)), vceqq_u8(bytes, v2));
+		// NEON has no movemask: keep one distinct bit per byte, and add up the bits of each half
+		auto masked = vandq_u8(match, bits);
+		uint64_t low = vaddv_u8(vget_low_u8(masked));
+		uint64_t high = vaddv_u8(vget_high_u8(masked));
+		result |= (low | high << 8) << i;
+	}
+	return result;
+}
+
+SIMDKernels SIMDKernels::NEONKernels() {
+	SIMDKernels result;
+	result.level = SIMDLevel::NEON;
+	result.hash_uint64 = NEONHash<uint64_t>;
+	result.hash_uint32 = NEONHash<uint32_t>;
+	result.combine_hash_uint64 = NEONCombineHash<uint64_t>;
+	result.combine_hash_uint32 = NEONCombineHash<uint32_t>;
+	result.select_int32 = NEONSelect<int32_t>;
+	result.select_int64 = NEONSelect<int64_t>;
+	result.select_float = NEONSelect<float>;
+	result.select_double = NEONSelect<double>;
+	result.count_bits = NEONCountBits;
+	result.match_bytes = NEONMatchBytes;
+	return result;
+}
+
+} // namespace duckdb
+
+#endif
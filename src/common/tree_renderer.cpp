@@ -489,6 +489,39 @@ unique_ptr<RenderTreeNode> TreeRenderer::CreateNode(const QueryProfiler::TreeNod
 	result->extra_text += "\n" + to_string(op.info.elements);
 	string timing = StringUtil::Format("%.2f", op.info.time);
 	result->extra_text += "\n(" + timing + "s)";
+
+	// only render the metrics the operator collected
+	auto &metrics = op.info.metrics;
+	if (metrics.bytes_read) {
+		result->extra_text += "\nread: " + StringUtil::BytesToHumanReadableString(metrics.bytes_read);
+	}
+	if (metrics.rows_pruned) {
+		result->extra_text += "\npruned: " + to_string(metrics.rows_pruned) + " rows";
+	}
+	if (metrics.hash_table_capacity) {
+		auto load = 100.0 * double(metrics.hash_table_entries) / double(metrics.hash_table_capacity);
+		result->extra_text += StringUtil::Format("\nht: %llu (%.0f%% full)", metrics.hash_table_entries, load);
+	}
+	if (metrics.bytes_spilled) {
+		result->extra_text += "\nspilled: " + StringUtil::BytesToHumanReadableString(metrics.bytes_spilled);
+	}
+	if (metrics.bytes_reloaded) {
+		result->extra_text += "\nreloaded: " + StringUtil::BytesToHumanReadableString(metrics.bytes_reloaded);
+	}
+	if (metrics.peak_memory) {
+		result->extra_text += "\npeak memory: " + StringUtil::BytesToHumanReadableString(metrics.peak_memory);
+	}
+	if (metrics.cpu_cycles) {
+		// instructions per cycle, a low IPC combined with many cache misses indicates a memory-bound operator
+		auto ipc = double(metrics.instructions) / double(metrics.cpu_cycles);
+		result->extra_text += StringUtil::Format("\ncycles: %llu (%.2f IPC)", metrics.cpu_cycles, ipc);
+	}
+	if (metrics.cache_misses) {
+		result->extra_text += "\ncache misses: " + to_string(metrics.cache_misses);
+	}
+	if (metrics.branch_misses) {
+		result->extra_text += "\nbranch misses: " + to_string(metrics.branch_misses);
+	}
 	return result;
 }
 
@@ -1,11 +1,17 @@
 #include "duckdb/common/types/validity_mask.hpp"
 #include "duckdb/common/limits.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/simd/simd_kernels.hpp"
 #include "duckdb/common/serializer/write_stream.hpp"
 #include "duckdb/common/serializer/read_stream.hpp"
 
 namespace duckdb {
 
+template <>
+idx_t TemplatedValidityMask<validity_t>::CountBits(const validity_t *entries, idx_t entry_count) {
+	return SIMDKernels::Get().count_bits(entries, entry_count);
+}
+
 ValidityData::ValidityData(idx_t count) : TemplatedValidityData(count) {
 }
 ValidityData::ValidityData(const ValidityMask &original, idx_t count)
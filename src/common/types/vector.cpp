@@ -1887,6 +1887,15 @@ void StringVector::AddBuffer(Vector &vector, buffer_ptr<VectorBuffer> buffer) {
 	string_buffer.AddHeapReference(std::move(buffer));
 }
 
+void StringVector::SetAuxiliaryData(Vector &vector, unique_ptr<VectorAuxiliaryData> aux_data) {
+	D_ASSERT(vector.GetType().InternalType() == PhysicalType::VARCHAR);
+	if (!vector.auxiliary) {
+		vector.auxiliary = make_buffer<VectorStringBuffer>();
+	}
+	D_ASSERT(vector.auxiliary->GetBufferType() == VectorBufferType::STRING_BUFFER);
+	vector.auxiliary->SetAuxiliaryData(std::move(aux_data));
+}
+
 void StringVector::AddHeapReference(Vector &vector, Vector &other) {
 	D_ASSERT(vector.GetType().InternalType() == PhysicalType::VARCHAR);
 	D_ASSERT(other.GetType().InternalType() == PhysicalType::VARCHAR);
@@ -3,6 +3,7 @@
 // Description: This file contains the vectorized hash implementations
 //===--------------------------------------------------------------------===//
 
+#include "duckdb/common/simd/simd_kernels.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/uhugeint.hpp"
@@ -24,6 +25,62 @@ static inline hash_t CombineHashScalar(hash_t a, hash_t b) {
 	return (a * UINT64_C(0xbf58476d1ce4e5b9)) ^ b;
 }
 
+//! Flat 32 and 64-bit integers without NULL values are hashed with the SIMD kernels
+template <class T>
+struct SIMDHashType {
+	using TYPE = void;
+};
+template <>
+struct SIMDHashType<int32_t> {
+	using TYPE = uint32_t;
+};
+template <>
+struct SIMDHashType<uint32_t> {
+	using TYPE = uint32_t;
+};
+template <>
+struct SIMDHashType<int64_t> {
+	using TYPE = uint64_t;
+};
+template <>
+struct SIMDHashType<uint64_t> {
+	using TYPE = uint64_t;
+};
+
+static inline bool SIMDHash(const void *ldata, hash_t *result_data, idx_t count) {
+	return false;
+}
+
+static inline bool SIMDHash(const uint32_t *ldata, hash_t *result_data, idx_t count) {
+	SIMDKernels::Get().hash_uint32(ldata, result_data, count);
+	return true;
+}
+
+static inline bool SIMDHash(const uint64_t *ldata, hash_t *result_data, idx_t count) {
+	SIMDKernels::Get().hash_uint64(ldata, result_data, count);
+	return true;
+}
+
+static inline bool SIMDCombineHash(const void *ldata, hash_t *hash_data, idx_t count) {
+	return false;
+}
+
+static inline bool SIMDCombineHash(const uint32_t *ldata, hash_t *hash_data, idx_t count) {
+	SIMDKernels::Get().combine_hash_uint32(ldata, hash_data, count);
+	return true;
+}
+
+static inline bool SIMDCombineHash(const uint64_t *ldata, hash_t *hash_data, idx_t count) {
+	SIMDKernels::Get().combine_hash_uint64(ldata, hash_data, count);
+	return true;
+}
+
+template <bool HAS_RSEL, class T>
+static inline bool CanUseSIMDHash(const UnifiedVectorFormat &idata) {
+	return !std::is_void<typename SIMDHashType<T>::TYPE>::value && !HAS_RSEL && !idata.sel->data() &&
+	       idata.validity.AllValid();
+}
+
 template <bool HAS_RSEL, class T>
 static inline void TightLoopHash(const T *__restrict ldata, hash_t *__restrict result_data, const SelectionVector *rsel,
                                  idx_t count, const SelectionVector *__restrict sel_vector, ValidityMask &mask) {
@@ -56,8 +113,13 @@ static inline void TemplatedLoopHash(Vector &input, Vector &result, const Select
 		UnifiedVectorFormat idata;
 		input.ToUnifiedFormat(count, idata);
 
-		TightLoopHash<HAS_RSEL, T>(UnifiedVectorFormat::GetData<T>(idata), FlatVector::GetData<hash_t>(result), rsel,
-		                           count, idata.sel, idata.validity);
+		auto ldata = UnifiedVectorFormat::GetData<T>(idata);
+		auto result_data = FlatVector::GetData<hash_t>(result);
+		if (CanUseSIMDHash<HAS_RSEL, T>(idata) &&
+		    SIMDHash(reinterpret_cast<const typename SIMDHashType<T>::TYPE *>(ldata), result_data, count)) {
+			return;
+		}
+		TightLoopHash<HAS_RSEL, T>(ldata, result_data, rsel, count, idata.sel, idata.validity);
 	}
 }
 
@@ -368,18 +430,29 @@ void TemplatedLoopCombineHash(Vector &input, Vector &hashes, const SelectionVect
 	} else {
 		UnifiedVectorFormat idata;
 		input.ToUnifiedFormat(count, idata);
+		auto ldata = UnifiedVectorFormat::GetData<T>(idata);
+		auto simd_ldata = reinterpret_cast<const typename SIMDHashType<T>::TYPE *>(ldata);
 		if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
 			// mix constant with non-constant, first get the constant value
 			auto constant_hash = *ConstantVector::GetData<hash_t>(hashes);
 			// now re-initialize the hashes vector to an empty flat vector
 			hashes.SetVectorType(VectorType::FLAT_VECTOR);
-			TightLoopCombineHashConstant<HAS_RSEL, T>(UnifiedVectorFormat::GetData<T>(idata), constant_hash,
-			                                          FlatVector::GetData<hash_t>(hashes), rsel, count, idata.sel,
-			                                          idata.validity);
+			if (CanUseSIMDHash<HAS_RSEL, T>(idata)) {
+				auto hash_data = FlatVector::GetData<hash_t>(hashes);
+				std::fill_n(hash_data, count, constant_hash);
+				if (SIMDCombineHash(simd_ldata, hash_data, count)) {
+					return;
+				}
+			}
+			TightLoopCombineHashConstant<HAS_RSEL, T>(ldata, constant_hash, FlatVector::GetData<hash_t>(hashes), rsel,
+			                                          count, idata.sel, idata.validity);
 		} else {
 			D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
-			TightLoopCombineHash<HAS_RSEL, T>(UnifiedVectorFormat::GetData<T>(idata),
-			                                  FlatVector::GetData<hash_t>(hashes), rsel, count, idata.sel,
+			if (CanUseSIMDHash<HAS_RSEL, T>(idata) &&
+			    SIMDCombineHash(simd_ldata, FlatVector::GetData<hash_t>(hashes), count)) {
+				return;
+			}
+			TightLoopCombineHash<HAS_RSEL, T>(ldata, FlatVector::GetData<hash_t>(hashes), rsel, count, idata.sel,
 			                                  idata.validity);
 		}
 	}
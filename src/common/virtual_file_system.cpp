@@ -2,6 +2,9 @@
 #include "duckdb/common/gzip_file_system.hpp"
 #include "duckdb/common/pipe_file_system.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/file_opener.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 namespace duckdb {
 
@@ -42,6 +45,11 @@ unique_ptr<FileHandle> VirtualFileSystem::OpenFile(const string &path, FileOpenF
 			    "Attempting to open a compressed file, but the compression type is not supported");
 		}
 		file_handle = entry->second->OpenCompressedFile(std::move(file_handle), flags.OpenForWriting());
+		auto context = FileOpener::TryGetClientContext(opener);
+		if (!flags.OpenForWriting() && context) {
+			auto threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(*context).NumberOfThreads());
+			entry->second->SetDecompressionThreads(*file_handle, threads);
+		}
 	}
 	return file_handle;
 }
@@ -1,14 +1,16 @@
 #include "duckdb/core_functions/aggregate/distributive_functions.hpp"
+#include "duckdb/core_functions/aggregate/sketch_helpers.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/hyperloglog.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 
 namespace duckdb {
 
 struct ApproxDistinctCountState {
-	ApproxDistinctCountState() : log(nullptr) {
+	ApproxDistinctCountState() : log(nullptr), is_empty(true) {
 	}
 	~ApproxDistinctCountState() {
 		if (log) {
@@ -17,12 +19,15 @@ struct ApproxDistinctCountState {
 	}
 
 	HyperLogLog *log;
+	//! Whether no (non-NULL) value was added, the log is created for every state that sees a row
+	bool is_empty;
 };
 
 struct ApproxCountDistinctFunction {
 	template <class STATE>
 	static void Initialize(STATE &state) {
 		state.log = nullptr;
+		state.is_empty = true;
 	}
 
 	template <class STATE, class OP>
@@ -30,6 +35,7 @@ struct ApproxCountDistinctFunction {
 		if (!source.log) {
 			return;
 		}
+		target.is_empty = target.is_empty && source.is_empty;
 		if (!target.log) {
 			target.log = new HyperLogLog();
 		}
@@ -73,6 +79,9 @@ static void ApproxCountDistinctSimpleUpdateFunction(Vector inputs[], AggregateIn
 
 	UnifiedVectorFormat vdata;
 	inputs[0].ToUnifiedFormat(count, vdata);
+	for (idx_t i = 0; i < count && agg_state->is_empty; i++) {
+		agg_state->is_empty = !vdata.validity.RowIsValid(vdata.sel->get_index(i));
+	}
 
 	if (count > STANDARD_VECTOR_SIZE) {
 		throw InternalException("ApproxCountDistinct - count must be at most vector size");
@@ -91,16 +100,19 @@ static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputDat
 	state_vector.ToUnifiedFormat(count, sdata);
 	auto states = UnifiedVectorFormat::GetDataNoConst<ApproxDistinctCountState *>(sdata);
 
+	UnifiedVectorFormat vdata;
+	inputs[0].ToUnifiedFormat(count, vdata);
+
 	for (idx_t i = 0; i < count; i++) {
 		auto agg_state = states[sdata.sel->get_index(i)];
 		if (!agg_state->log) {
 			agg_state->log = new HyperLogLog();
 		}
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			agg_state->is_empty = false;
+		}
 	}
 
-	UnifiedVectorFormat vdata;
-	inputs[0].ToUnifiedFormat(count, vdata);
-
 	if (count > STANDARD_VECTOR_SIZE) {
 		throw InternalException("ApproxCountDistinct - count must be at most vector size");
 	}
@@ -110,37 +122,110 @@ static void ApproxCountDistinctUpdateFunction(Vector inputs[], AggregateInputDat
 	HyperLogLog::AddToLogs(vdata, count, indices, counts, reinterpret_cast<HyperLogLog ***>(states), sdata.sel);
 }
 
-AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type) {
+template <class OP, class RESULT_TYPE>
+static AggregateFunction GetApproxCountDistinctFunction(const LogicalType &input_type,
+                                                        const LogicalType &result_type) {
 	auto fun = AggregateFunction(
-	    {input_type}, LogicalTypeId::BIGINT, AggregateFunction::StateSize<ApproxDistinctCountState>,
-	    AggregateFunction::StateInitialize<ApproxDistinctCountState, ApproxCountDistinctFunction>,
-	    ApproxCountDistinctUpdateFunction,
-	    AggregateFunction::StateCombine<ApproxDistinctCountState, ApproxCountDistinctFunction>,
-	    AggregateFunction::StateFinalize<ApproxDistinctCountState, int64_t, ApproxCountDistinctFunction>,
+	    {input_type}, result_type, AggregateFunction::StateSize<ApproxDistinctCountState>,
+	    AggregateFunction::StateInitialize<ApproxDistinctCountState, OP>, ApproxCountDistinctUpdateFunction,
+	    AggregateFunction::StateCombine<ApproxDistinctCountState, OP>,
+	    AggregateFunction::StateFinalize<ApproxDistinctCountState, RESULT_TYPE, OP>,
 	    ApproxCountDistinctSimpleUpdateFunction, nullptr,
-	    AggregateFunction::StateDestroy<ApproxDistinctCountState, ApproxCountDistinctFunction>);
+	    AggregateFunction::StateDestroy<ApproxDistinctCountState, OP>);
 	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
 	return fun;
 }
 
+template <class OP, class RESULT_TYPE>
+static void AddApproxCountDistinctFunctions(AggregateFunctionSet &set, const LogicalType &result_type) {
+	const vector<LogicalType> input_types {LogicalType::UTINYINT, LogicalType::USMALLINT, LogicalType::UINTEGER,
+	                                       LogicalType::UBIGINT,  LogicalType::UHUGEINT,  LogicalType::TINYINT,
+	                                       LogicalType::SMALLINT, LogicalType::BIGINT,    LogicalType::HUGEINT,
+	                                       LogicalType::FLOAT,    LogicalType::DOUBLE,    LogicalType::TIMESTAMP,
+	                                       LogicalType::TIMESTAMP_TZ, LogicalType::BLOB};
+	for (auto &input_type : input_types) {
+		set.AddFunction(GetApproxCountDistinctFunction<OP, RESULT_TYPE>(input_type, result_type));
+	}
+	auto varchar_type = LogicalType::ANY_PARAMS(LogicalType::VARCHAR, 150);
+	set.AddFunction(GetApproxCountDistinctFunction<OP, RESULT_TYPE>(varchar_type, result_type));
+}
+
 AggregateFunctionSet ApproxCountDistinctFun::GetFunctions() {
 	AggregateFunctionSet approx_count("approx_count_distinct");
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UTINYINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::USMALLINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UINTEGER));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UBIGINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::UHUGEINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TINYINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::SMALLINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::BIGINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::HUGEINT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::FLOAT));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::DOUBLE));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TIMESTAMP));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::TIMESTAMP_TZ));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::BLOB));
-	approx_count.AddFunction(GetApproxCountDistinctFunction(LogicalType::ANY_PARAMS(LogicalType::VARCHAR, 150)));
+	AddApproxCountDistinctFunctions<ApproxCountDistinctFunction, int64_t>(approx_count, LogicalType::BIGINT);
 	return approx_count;
 }
 
+//===--------------------------------------------------------------------===//
+// HyperLogLog sketches
+//===--------------------------------------------------------------------===//
+static unique_ptr<HyperLogLog> HyperLogLogFromSketch(const string_t &sketch) {
+	idx_t size;
+	auto data = SketchHeader::Read(sketch, SketchType::HYPERLOGLOG, size);
+	if (size != HyperLogLog::GetSize()) {
+		throw InvalidInputException("Invalid HyperLogLog sketch: expected %llu bytes, but got %llu",
+		                            HyperLogLog::GetSize(), size);
+	}
+	auto result = make_uniq<HyperLogLog>();
+	memcpy(result->GetPtr(), data, size);
+	return result;
+}
+
+struct HyperLogLogSketchFunction : public ApproxCountDistinctFunction {
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.log || state.is_empty) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		data_ptr_t sketch;
+		target = SketchHeader::Create(finalize_data.result, SketchType::HYPERLOGLOG, HyperLogLog::GetSize(), sketch);
+		memcpy(sketch, state.log->GetPtr(), HyperLogLog::GetSize());
+		target.Finalize();
+	}
+};
+
+struct HyperLogLogMergeFunction : public HyperLogLogSketchFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		auto log = HyperLogLogFromSketch(input);
+		state.is_empty = false;
+		if (!state.log) {
+			state.log = log.release();
+			return;
+		}
+		auto new_log = state.log->MergePointer(*log);
+		delete state.log;
+		state.log = new_log;
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		// merging a sketch with itself does not change it
+		Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+AggregateFunctionSet HllSketchFun::GetFunctions() {
+	AggregateFunctionSet hll_sketch("hll_sketch");
+	AddApproxCountDistinctFunctions<HyperLogLogSketchFunction, string_t>(hll_sketch, LogicalType::BLOB);
+	return hll_sketch;
+}
+
+AggregateFunction HllMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxDistinctCountState, string_t, string_t,
+	                                                   HyperLogLogMergeFunction>(LogicalType::BLOB, LogicalType::BLOB);
+}
+
+static void HyperLogLogEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(), [&](string_t sketch) {
+		return UnsafeNumericCast<int64_t>(HyperLogLogFromSketch(sketch)->Count());
+	});
+}
+
+ScalarFunction HllEstimateFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB}, LogicalType::BIGINT, HyperLogLogEstimateFunction);
+}
+
 } // namespace duckdb
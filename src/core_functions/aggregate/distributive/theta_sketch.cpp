@@ -0,0 +1,277 @@
+#include "duckdb/core_functions/aggregate/distributive_functions.hpp"
+#include "duckdb/core_functions/aggregate/sketch_helpers.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/common/vector_operations/unary_executor.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/function/function_set.hpp"
+
+namespace duckdb {
+
+//! A theta sketch (K minimum values) retains all distinct hashes below theta, where theta is lowered such that at
+//! most NOMINAL_ENTRIES hashes are retained. Sketches can be unioned and intersected.
+class ThetaSketch {
+public:
+	static constexpr const idx_t NOMINAL_ENTRIES = 4096;
+
+	void Add(uint64_t hash) {
+		if (hash >= theta) {
+			return;
+		}
+		hashes.push_back(hash);
+		if (hashes.size() >= 2 * NOMINAL_ENTRIES) {
+			Compact();
+		}
+	}
+
+	//! Sorts and deduplicates the hashes, and lowers theta if more than NOMINAL_ENTRIES hashes are retained
+	void Compact() {
+		std::sort(hashes.begin(), hashes.end());
+		hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+		if (hashes.size() > NOMINAL_ENTRIES) {
+			theta = hashes[NOMINAL_ENTRIES];
+			hashes.resize(NOMINAL_ENTRIES);
+		}
+	}
+
+	void Union(const ThetaSketch &other) {
+		theta = MinValue(theta, other.theta);
+		for (auto &hash : other.hashes) {
+			Add(hash);
+		}
+		RemoveAboveTheta();
+	}
+
+	void Intersect(ThetaSketch &other) {
+		Compact();
+		other.Compact();
+		theta = MinValue(theta, other.theta);
+		vector<uint64_t> result;
+		std::set_intersection(hashes.begin(), hashes.end(), other.hashes.begin(), other.hashes.end(),
+		                      std::back_inserter(result));
+		hashes = std::move(result);
+		RemoveAboveTheta();
+	}
+
+	int64_t Estimate() {
+		Compact();
+		if (theta == NumericLimits<uint64_t>::Maximum()) {
+			// all distinct hashes are retained
+			return NumericCast<int64_t>(hashes.size());
+		}
+		auto fraction = static_cast<double>(theta) / static_cast<double>(NumericLimits<uint64_t>::Maximum());
+		return static_cast<int64_t>(std::llround(static_cast<double>(hashes.size()) / fraction));
+	}
+
+	string_t Serialize(Vector &result) {
+		Compact();
+		data_ptr_t data;
+		auto blob = SketchHeader::Create(result, SketchType::THETA, sizeof(uint64_t) * (hashes.size() + 1), data);
+		Store<uint64_t>(theta, data);
+		data += sizeof(uint64_t);
+		for (auto &hash : hashes) {
+			Store<uint64_t>(hash, data);
+			data += sizeof(uint64_t);
+		}
+		blob.Finalize();
+		return blob;
+	}
+
+	static unique_ptr<ThetaSketch> Deserialize(const string_t &blob) {
+		idx_t size;
+		auto data = SketchHeader::Read(blob, SketchType::THETA, size);
+		if (size < sizeof(uint64_t) || size % sizeof(uint64_t) != 0) {
+			throw InvalidInputException("Invalid theta sketch: unexpected size of %llu bytes", size);
+		}
+		auto result = make_uniq<ThetaSketch>();
+		result->theta = Load<uint64_t>(data);
+		data += sizeof(uint64_t);
+		const auto count = size / sizeof(uint64_t) - 1;
+		result->hashes.reserve(count);
+		for (idx_t i = 0; i < count; i++) {
+			result->hashes.push_back(Load<uint64_t>(data));
+			data += sizeof(uint64_t);
+		}
+		return result;
+	}
+
+private:
+	void RemoveAboveTheta() {
+		hashes.erase(std::remove_if(hashes.begin(), hashes.end(), [&](uint64_t hash) { return hash >= theta; }),
+		             hashes.end());
+	}
+
+private:
+	uint64_t theta = NumericLimits<uint64_t>::Maximum();
+	vector<uint64_t> hashes;
+};
+
+struct ThetaSketchState {
+	ThetaSketch *sketch;
+};
+
+struct ThetaSketchFunction {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.sketch = nullptr;
+	}
+
+	template <class STATE, class OP>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		if (!source.sketch) {
+			return;
+		}
+		if (!target.sketch) {
+			target.sketch = new ThetaSketch();
+		}
+		target.sketch->Union(*source.sketch);
+	}
+
+	template <class T, class STATE>
+	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
+		if (!state.sketch) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		target = state.sketch->Serialize(finalize_data.result);
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+
+	template <class STATE>
+	static void Destroy(STATE &state, AggregateInputData &aggr_input_data) {
+		if (state.sketch) {
+			delete state.sketch;
+			state.sketch = nullptr;
+		}
+	}
+};
+
+struct ThetaMergeFunction : public ThetaSketchFunction {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		auto sketch = ThetaSketch::Deserialize(input);
+		if (!state.sketch) {
+			state.sketch = sketch.release();
+			return;
+		}
+		state.sketch->Union(*sketch);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		// the union of a sketch with itself does not change it
+		Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+	}
+};
+
+static void ThetaSketchSimpleUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count,
+                                            data_ptr_t state_p, idx_t count) {
+	D_ASSERT(input_count == 1);
+	auto &state = *reinterpret_cast<ThetaSketchState *>(state_p);
+
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(inputs[0], hashes, count);
+
+	UnifiedVectorFormat vdata;
+	inputs[0].ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			continue;
+		}
+		if (!state.sketch) {
+			state.sketch = new ThetaSketch();
+		}
+		state.sketch->Add(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+static void ThetaSketchUpdateFunction(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &state_vector,
+                                      idx_t count) {
+	D_ASSERT(input_count == 1);
+
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(inputs[0], hashes, count);
+
+	UnifiedVectorFormat vdata;
+	inputs[0].ToUnifiedFormat(count, vdata);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	UnifiedVectorFormat sdata;
+	state_vector.ToUnifiedFormat(count, sdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	auto states = UnifiedVectorFormat::GetDataNoConst<ThetaSketchState *>(sdata);
+	for (idx_t i = 0; i < count; i++) {
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			continue;
+		}
+		auto &state = *states[sdata.sel->get_index(i)];
+		if (!state.sketch) {
+			state.sketch = new ThetaSketch();
+		}
+		state.sketch->Add(hash_data[hdata.sel->get_index(i)]);
+	}
+}
+
+AggregateFunction ThetaSketchFun::GetFunction() {
+	auto fun = AggregateFunction(
+	    {LogicalType::ANY}, LogicalType::BLOB, AggregateFunction::StateSize<ThetaSketchState>,
+	    AggregateFunction::StateInitialize<ThetaSketchState, ThetaSketchFunction>, ThetaSketchUpdateFunction,
+	    AggregateFunction::StateCombine<ThetaSketchState, ThetaSketchFunction>,
+	    AggregateFunction::StateFinalize<ThetaSketchState, string_t, ThetaSketchFunction>,
+	    ThetaSketchSimpleUpdateFunction, nullptr,
+	    AggregateFunction::StateDestroy<ThetaSketchState, ThetaSketchFunction>);
+	fun.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return fun;
+}
+
+AggregateFunction ThetaMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ThetaSketchState, string_t, string_t, ThetaMergeFunction>(
+	    LogicalType::BLOB, LogicalType::BLOB);
+}
+
+static void ThetaEstimateFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	UnaryExecutor::Execute<string_t, int64_t>(args.data[0], result, args.size(), [&](string_t sketch) {
+		return ThetaSketch::Deserialize(sketch)->Estimate();
+	});
+}
+
+ScalarFunction ThetaEstimateFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB}, LogicalType::BIGINT, ThetaEstimateFunction);
+}
+
+static void ThetaUnionFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::Execute<string_t, string_t, string_t>(
+	    args.data[0], args.data[1], result, args.size(), [&](string_t left, string_t right) {
+		    auto sketch = ThetaSketch::Deserialize(left);
+		    sketch->Union(*ThetaSketch::Deserialize(right));
+		    return sketch->Serialize(result);
+	    });
+}
+
+ScalarFunction ThetaUnionFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::BLOB}, LogicalType::BLOB, ThetaUnionFunction);
+}
+
+static void ThetaIntersectFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::Execute<string_t, string_t, string_t>(
+	    args.data[0], args.data[1], result, args.size(), [&](string_t left, string_t right) {
+		    auto sketch = ThetaSketch::Deserialize(left);
+		    sketch->Intersect(*ThetaSketch::Deserialize(right));
+		    return sketch->Serialize(result);
+	    });
+}
+
+ScalarFunction ThetaIntersectFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::BLOB}, LogicalType::BLOB, ThetaIntersectFunction);
+}
+
+} // namespace duckdb
@@ -5,6 +5,8 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/vector_operations/binary_executor.hpp"
+#include "duckdb/core_functions/aggregate/sketch_helpers.hpp"
 
 #include <algorithm>
 #include <cmath>
@@ -363,4 +365,108 @@ AggregateFunctionSet ApproxQuantileFun::GetFunctions() {
 	return approx_quantile;
 }
 
+//===--------------------------------------------------------------------===//
+// t-digest sketches
+//===--------------------------------------------------------------------===//
+// A t-digest is stored as its compressed centroids: pairs of (mean, weight)
+static string_t SerializeTDigest(duckdb_tdigest::TDigest &digest, Vector &result) {
+	digest.compress();
+	auto &centroids = digest.processed();
+	data_ptr_t data;
+	auto blob = SketchHeader::Create(result, SketchType::TDIGEST, 2 * sizeof(double) * centroids.size(), data);
+	for (auto &centroid : centroids) {
+		Store<double>(centroid.mean(), data);
+		Store<double>(centroid.weight(), data + sizeof(double));
+		data += 2 * sizeof(double);
+	}
+	blob.Finalize();
+	return blob;
+}
+
+static unique_ptr<duckdb_tdigest::TDigest> DeserializeTDigest(const string_t &blob) {
+	idx_t size;
+	auto data = SketchHeader::Read(blob, SketchType::TDIGEST, size);
+	if (size % (2 * sizeof(double)) != 0) {
+		throw InvalidInputException("Invalid t-digest sketch: unexpected size of %llu bytes", size);
+	}
+	auto result = make_uniq<duckdb_tdigest::TDigest>(100);
+	for (idx_t i = 0; i < size / (2 * sizeof(double)); i++) {
+		auto mean = Load<double>(data);
+		auto weight = Load<double>(data + sizeof(double));
+		if (!Value::DoubleIsFinite(mean) || !(weight > 0)) {
+			throw InvalidInputException("Invalid t-digest sketch: invalid centroid");
+		}
+		result->add(mean, weight);
+		data += 2 * sizeof(double);
+	}
+	// move the centroids from the unprocessed buffer into the processed centroids
+	result->compress();
+	return result;
+}
+
+struct TDigestSketchOperation : public ApproxQuantileOperation {
+	template <class TARGET_TYPE, class STATE>
+	static void Finalize(STATE &state, TARGET_TYPE &target, AggregateFinalizeData &finalize_data) {
+		if (state.pos == 0) {
+			finalize_data.ReturnNull();
+			return;
+		}
+		D_ASSERT(state.h);
+		target = SerializeTDigest(*state.h, finalize_data.result);
+	}
+};
+
+struct TDigestMergeOperation : public TDigestSketchOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input,
+	                              idx_t count) {
+		for (idx_t i = 0; i < count; i++) {
+			Operation<INPUT_TYPE, STATE, OP>(state, input, unary_input);
+		}
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		auto digest = DeserializeTDigest(input);
+		if (digest->processed().empty()) {
+			return;
+		}
+		if (!state.h) {
+			state.h = new duckdb_tdigest::TDigest(100);
+		}
+		state.h->merge(digest.get());
+		state.pos++;
+	}
+};
+
+AggregateFunction TdigestSketchFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, double, string_t, TDigestSketchOperation>(
+	    LogicalType::DOUBLE, LogicalType::BLOB);
+}
+
+AggregateFunction TdigestMergeFun::GetFunction() {
+	return AggregateFunction::UnaryAggregateDestructor<ApproxQuantileState, string_t, string_t, TDigestMergeOperation>(
+	    LogicalType::BLOB, LogicalType::BLOB);
+}
+
+static void TDigestQuantileFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	BinaryExecutor::ExecuteWithNulls<string_t, double, double>(
+	    args.data[0], args.data[1], result, args.size(),
+	    [&](string_t sketch, double quantile, ValidityMask &mask, idx_t idx) {
+		    if (quantile < 0 || quantile > 1) {
+			    throw InvalidInputException("TDIGEST_QUANTILE can only take parameters in range [0, 1]");
+		    }
+		    auto digest = DeserializeTDigest(sketch);
+		    if (digest->processed().empty()) {
+			    mask.SetInvalid(idx);
+			    return 0.0;
+		    }
+		    return digest->quantile(quantile);
+	    });
+}
+
+ScalarFunction TdigestQuantileFun::GetFunction() {
+	return ScalarFunction({LogicalType::BLOB, LogicalType::DOUBLE}, LogicalType::DOUBLE, TDigestQuantileFunction);
+}
+
 } // namespace duckdb
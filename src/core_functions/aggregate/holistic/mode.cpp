@@ -9,6 +9,7 @@
 #include "duckdb/core_functions/aggregate/holistic_functions.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 #include <functional>
 
@@ -50,7 +51,8 @@ struct ModeState {
 		size_t count;
 		idx_t first_row;
 	};
-	using Counts = unordered_map<KEY_TYPE, ModeAttr>;
+	using CountsAllocator = ArenaStlAllocator<std::pair<const KEY_TYPE, ModeAttr>>;
+	using Counts = unordered_map<KEY_TYPE, ModeAttr, std::hash<KEY_TYPE>, std::equal_to<KEY_TYPE>, CountsAllocator>;
 
 	ModeState() {
 	}
@@ -64,15 +66,28 @@ struct ModeState {
 
 	~ModeState() {
 		if (frequency_map) {
-			delete frequency_map;
+			if (frequency_map->get_allocator().arena) {
+				// the map lives in the arena of the aggregate, only the destructor has to run
+				frequency_map->~Counts();
+			} else {
+				delete frequency_map;
+			}
 		}
 		if (mode) {
 			delete mode;
 		}
 	}
 
+	//! Creates the frequency map in the arena of the aggregate, so its memory is accounted for by the buffer manager
+	void InitializeCounts(ArenaAllocator &allocator) {
+		if (!frequency_map) {
+			auto data = allocator.AllocateAligned(sizeof(Counts));
+			frequency_map = new (data) Counts(CountsAllocator(allocator));
+		}
+	}
+
 	void Reset() {
-		Counts empty;
+		Counts empty(frequency_map->get_allocator());
 		frequency_map->swap(empty);
 		nonzero = 0;
 		count = 0;
@@ -159,10 +174,8 @@ struct ModeFunction {
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
-	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
-		if (!state.frequency_map) {
-			state.frequency_map = new typename STATE::Counts();
-		}
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &aggr_input) {
+		state.InitializeCounts(aggr_input.input.allocator);
 		auto key = KEY_TYPE(input);
 		auto &i = (*state.frequency_map)[key];
 		i.count++;
@@ -171,15 +184,12 @@ struct ModeFunction {
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
 		if (!source.frequency_map) {
 			return;
 		}
-		if (!target.frequency_map) {
-			// Copy - don't destroy! Otherwise windowing will break.
-			target.frequency_map = new typename STATE::Counts(*source.frequency_map);
-			return;
-		}
+		// Copy - don't destroy! Otherwise windowing will break.
+		target.InitializeCounts(aggr_input_data.allocator);
 		for (auto &val : *source.frequency_map) {
 			auto &i = (*target.frequency_map)[val.first];
 			i.count += val.second.count;
@@ -202,10 +212,8 @@ struct ModeFunction {
 		}
 	}
 	template <class INPUT_TYPE, class STATE, class OP>
-	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &, idx_t count) {
-		if (!state.frequency_map) {
-			state.frequency_map = new typename STATE::Counts();
-		}
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &aggr_input, idx_t count) {
+		state.InitializeCounts(aggr_input.input.allocator);
 		auto key = KEY_TYPE(input);
 		auto &i = (*state.frequency_map)[key];
 		i.count += count;
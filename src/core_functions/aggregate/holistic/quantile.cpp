@@ -1,7 +1,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/core_functions/aggregate/holistic_functions.hpp"
 #include "duckdb/execution/merge_sort_tree.hpp"
-#include "duckdb/core_functions/aggregate/quantile_enum.hpp"
+#include "duckdb/core_functions/aggregate/quantile_helpers.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/abs.hpp"
@@ -11,6 +11,7 @@
 #include "duckdb/common/queue.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 #include "SkipList.h"
 
@@ -136,18 +137,6 @@ void ReuseIndexes(idx_t *index, const SubFrames &currs, const SubFrames &prevs)
 	}
 }
 
-template <class INPUT_TYPE>
-struct IndirectLess {
-	inline explicit IndirectLess(const INPUT_TYPE *inputs_p) : inputs(inputs_p) {
-	}
-
-	inline bool operator()(const idx_t &lhi, const idx_t &rhi) const {
-		return inputs[lhi] < inputs[rhi];
-	}
-
-	const INPUT_TYPE *inputs;
-};
-
 struct CastInterpolation {
 
 	template <class INPUT_TYPE, class TARGET_TYPE>
@@ -262,36 +251,6 @@ struct QuantileCompare {
 	}
 };
 
-//	Avoid using naked Values in inner loops...
-struct QuantileValue {
-	explicit QuantileValue(const Value &v) : val(v), dbl(v.GetValue<double>()) {
-		const auto &type = val.type();
-		switch (type.id()) {
-		case LogicalTypeId::DECIMAL: {
-			integral = IntegralValue::Get(v);
-			scaling = Hugeint::POWERS_OF_TEN[DecimalType::GetScale(type)];
-			break;
-		}
-		default:
-			break;
-		}
-	}
-
-	Value val;
-
-	//	DOUBLE
-	double dbl;
-
-	//	DECIMAL
-	hugeint_t integral;
-	hugeint_t scaling;
-};
-
-bool operator==(const QuantileValue &x, const QuantileValue &y) {
-	return x.val == y.val;
-}
-
-// Continuous interpolation
 template <bool DISCRETE>
 struct Interpolator {
 	Interpolator(const QuantileValue &q, const idx_t n_p, const bool desc_p)
@@ -404,164 +363,6 @@ struct Interpolator<true> {
 	idx_t end;
 };
 
-template <typename T>
-static inline T QuantileAbs(const T &t) {
-	return AbsOperator::Operation<T, T>(t);
-}
-
-template <>
-inline Value QuantileAbs(const Value &v) {
-	const auto &type = v.type();
-	switch (type.id()) {
-	case LogicalTypeId::DECIMAL: {
-		const auto integral = IntegralValue::Get(v);
-		const auto width = DecimalType::GetWidth(type);
-		const auto scale = DecimalType::GetScale(type);
-		switch (type.InternalType()) {
-		case PhysicalType::INT16:
-			return Value::DECIMAL(QuantileAbs<int16_t>(Cast::Operation<hugeint_t, int16_t>(integral)), width, scale);
-		case PhysicalType::INT32:
-			return Value::DECIMAL(QuantileAbs<int32_t>(Cast::Operation<hugeint_t, int32_t>(integral)), width, scale);
-		case PhysicalType::INT64:
-			return Value::DECIMAL(QuantileAbs<int64_t>(Cast::Operation<hugeint_t, int64_t>(integral)), width, scale);
-		case PhysicalType::INT128:
-			return Value::DECIMAL(QuantileAbs<hugeint_t>(integral), width, scale);
-		default:
-			throw InternalException("Unknown DECIMAL type");
-		}
-	}
-	default:
-		return Value::DOUBLE(QuantileAbs<double>(v.GetValue<double>()));
-	}
-}
-
-void BindQuantileInner(AggregateFunction &function, const LogicalType &type, QuantileSerializationType quantile_type);
-
-struct QuantileBindData : public FunctionData {
-	QuantileBindData() {
-	}
-
-	explicit QuantileBindData(const Value &quantile_p)
-	    : quantiles(1, QuantileValue(QuantileAbs(quantile_p))), order(1, 0), desc(quantile_p < 0) {
-	}
-
-	explicit QuantileBindData(const vector<Value> &quantiles_p) {
-		vector<Value> normalised;
-		size_t pos = 0;
-		size_t neg = 0;
-		for (idx_t i = 0; i < quantiles_p.size(); ++i) {
-			const auto &q = quantiles_p[i];
-			pos += (q > 0);
-			neg += (q < 0);
-			normalised.emplace_back(QuantileAbs(q));
-			order.push_back(i);
-		}
-		if (pos && neg) {
-			throw BinderException("QUANTILE parameters must have consistent signs");
-		}
-		desc = (neg > 0);
-
-		IndirectLess<Value> lt(normalised.data());
-		std::sort(order.begin(), order.end(), lt);
-
-		for (const auto &q : normalised) {
-			quantiles.emplace_back(QuantileValue(q));
-		}
-	}
-
-	QuantileBindData(const QuantileBindData &other) : order(other.order), desc(other.desc) {
-		for (const auto &q : other.quantiles) {
-			quantiles.emplace_back(q);
-		}
-	}
-
-	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<QuantileBindData>(*this);
-	}
-
-	bool Equals(const FunctionData &other_p) const override {
-		auto &other = other_p.Cast<QuantileBindData>();
-		return desc == other.desc && quantiles == other.quantiles && order == other.order;
-	}
-
-	static void Serialize(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
-	                      const AggregateFunction &function) {
-		auto &bind_data = bind_data_p->Cast<QuantileBindData>();
-		vector<Value> raw;
-		for (const auto &q : bind_data.quantiles) {
-			raw.emplace_back(q.val);
-		}
-		serializer.WriteProperty(100, "quantiles", raw);
-		serializer.WriteProperty(101, "order", bind_data.order);
-		serializer.WriteProperty(102, "desc", bind_data.desc);
-	}
-
-	static unique_ptr<FunctionData> Deserialize(Deserializer &deserializer, AggregateFunction &function) {
-		auto result = make_uniq<QuantileBindData>();
-		vector<Value> raw;
-		deserializer.ReadProperty(100, "quantiles", raw);
-		deserializer.ReadProperty(101, "order", result->order);
-		deserializer.ReadProperty(102, "desc", result->desc);
-		QuantileSerializationType deserialization_type;
-		deserializer.ReadPropertyWithDefault(103, "quantile_type", deserialization_type,
-		                                     QuantileSerializationType::NON_DECIMAL);
-
-		if (deserialization_type != QuantileSerializationType::NON_DECIMAL) {
-			LogicalType arg_type;
-			deserializer.ReadProperty(104, "logical_type", arg_type);
-
-			BindQuantileInner(function, arg_type, deserialization_type);
-		}
-
-		for (const auto &r : raw) {
-			result->quantiles.emplace_back(QuantileValue(r));
-		}
-		return std::move(result);
-	}
-
-	static void SerializeDecimalDiscrete(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
-	                                     const AggregateFunction &function) {
-		Serialize(serializer, bind_data_p, function);
-
-		serializer.WritePropertyWithDefault<QuantileSerializationType>(
-		    103, "quantile_type", QuantileSerializationType::DECIMAL_DISCRETE, QuantileSerializationType::NON_DECIMAL);
-		serializer.WriteProperty(104, "logical_type", function.arguments[0]);
-	}
-	static void SerializeDecimalDiscreteList(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
-	                                         const AggregateFunction &function) {
-
-		Serialize(serializer, bind_data_p, function);
-
-		serializer.WritePropertyWithDefault<QuantileSerializationType>(103, "quantile_type",
-		                                                               QuantileSerializationType::DECIMAL_DISCRETE_LIST,
-		                                                               QuantileSerializationType::NON_DECIMAL);
-		serializer.WriteProperty(104, "logical_type", function.arguments[0]);
-	}
-	static void SerializeDecimalContinuous(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
-	                                       const AggregateFunction &function) {
-		Serialize(serializer, bind_data_p, function);
-
-		serializer.WritePropertyWithDefault<QuantileSerializationType>(103, "quantile_type",
-		                                                               QuantileSerializationType::DECIMAL_CONTINUOUS,
-		                                                               QuantileSerializationType::NON_DECIMAL);
-		serializer.WriteProperty(104, "logical_type", function.arguments[0]);
-	}
-	static void SerializeDecimalContinuousList(Serializer &serializer, const optional_ptr<FunctionData> bind_data_p,
-	                                           const AggregateFunction &function) {
-
-		Serialize(serializer, bind_data_p, function);
-
-		serializer.WritePropertyWithDefault<QuantileSerializationType>(
-		    103, "quantile_type", QuantileSerializationType::DECIMAL_CONTINUOUS_LIST,
-		    QuantileSerializationType::NON_DECIMAL);
-		serializer.WriteProperty(104, "logical_type", function.arguments[0]);
-	}
-
-	vector<QuantileValue> quantiles;
-	vector<idx_t> order;
-	bool desc;
-};
-
 template <typename IDX>
 struct QuantileSortTree : public MergeSortTree<IDX, IDX> {
 
@@ -671,8 +472,8 @@ struct QuantileState {
 	using SaveType = SAVE_TYPE;
 	using InputType = INPUT_TYPE;
 
-	// Regular aggregation
-	vector<SaveType> v;
+	// Regular aggregation: the values are stored in the arena allocator of the aggregate
+	std::vector<SaveType, ArenaStlAllocator<SaveType>> v;
 
 	// Windowed Quantile merge sort trees
 	using QuantileSortTree32 = QuantileSortTree<uint32_t>;
@@ -697,6 +498,13 @@ struct QuantileState {
 	~QuantileState() {
 	}
 
+	inline void InitializeValues(ArenaAllocator &allocator) {
+		if (!v.get_allocator().arena) {
+			D_ASSERT(v.empty());
+			v = std::vector<SaveType, ArenaStlAllocator<SaveType>>(ArenaStlAllocator<SaveType>(allocator));
+		}
+	}
+
 	inline void SetCount(size_t count_p) {
 		count = count_p;
 		if (count >= m.size()) {
@@ -810,6 +618,22 @@ struct QuantileState {
 	}
 };
 
+//! Copies the value into storage that lives as long as the aggregate state
+template <class T>
+static T QuantileCopyValue(const T &input, ArenaAllocator &allocator) {
+	return input;
+}
+
+static string_t QuantileCopyValue(const string_t &input, ArenaAllocator &allocator) {
+	if (input.IsInlined()) {
+		return input;
+	}
+	auto size = input.GetSize();
+	auto string_data = allocator.Allocate(size);
+	memcpy(string_data, input.GetData(), size);
+	return string_t(char_ptr_cast(string_data), UnsafeNumericCast<uint32_t>(size));
+}
+
 struct QuantileOperation {
 	template <class STATE>
 	static void Initialize(STATE &state) {
@@ -825,15 +649,19 @@ struct QuantileOperation {
 	}
 
 	template <class INPUT_TYPE, class STATE, class OP>
-	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
-		state.v.emplace_back(input);
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &unary_input) {
+		auto &allocator = unary_input.input.allocator;
+		state.InitializeValues(allocator);
+		state.v.emplace_back(QuantileCopyValue(input, allocator));
 	}
 
 	template <class STATE, class OP>
-	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &aggr_input_data) {
 		if (source.v.empty()) {
 			return;
 		}
+		// (the string data of the source stays alive in the arena of the source)
+		target.InitializeValues(aggr_input_data.allocator);
 		target.v.insert(target.v.end(), source.v.begin(), source.v.end());
 	}
 
@@ -1013,7 +841,7 @@ AggregateFunction GetDiscreteQuantileAggregateFunction(const LogicalType &type)
 	case LogicalTypeId::INTERVAL:
 		return GetTypedDiscreteQuantileAggregateFunction<interval_t, interval_t>(type);
 	case LogicalTypeId::ANY:
-		return GetTypedDiscreteQuantileAggregateFunction<string_t, std::string>(type);
+		return GetTypedDiscreteQuantileAggregateFunction<string_t, string_t>(type);
 
 	default:
 		throw NotImplementedException("Unimplemented discrete quantile aggregate");
@@ -1135,7 +963,7 @@ AggregateFunction GetDiscreteQuantileListAggregateFunction(const LogicalType &ty
 	case LogicalTypeId::INTERVAL:
 		return GetTypedDiscreteQuantileListAggregateFunction<interval_t, interval_t>(type);
 	case LogicalTypeId::ANY:
-		return GetTypedDiscreteQuantileListAggregateFunction<string_t, std::string>(type);
+		return GetTypedDiscreteQuantileListAggregateFunction<string_t, string_t>(type);
 	default:
 		throw NotImplementedException("Unimplemented discrete quantile list aggregate");
 	}
@@ -189,6 +189,9 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION(HashFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HexFun),
 	DUCKDB_AGGREGATE_FUNCTION_SET(HistogramFun),
+	DUCKDB_SCALAR_FUNCTION(HllEstimateFun),
+	DUCKDB_AGGREGATE_FUNCTION(HllMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION_SET(HllSketchFun),
 	DUCKDB_SCALAR_FUNCTION_SET(HoursFun),
 	DUCKDB_SCALAR_FUNCTION(InSearchPathFun),
 	DUCKDB_SCALAR_FUNCTION(InstrFun),
@@ -340,6 +343,14 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_AGGREGATE_FUNCTION_SET(SumNoOverflowFun),
 	DUCKDB_AGGREGATE_FUNCTION_ALIAS(SumkahanFun),
 	DUCKDB_SCALAR_FUNCTION(TanFun),
+	DUCKDB_AGGREGATE_FUNCTION(TdigestMergeFun),
+	DUCKDB_SCALAR_FUNCTION(TdigestQuantileFun),
+	DUCKDB_AGGREGATE_FUNCTION(TdigestSketchFun),
+	DUCKDB_SCALAR_FUNCTION(ThetaEstimateFun),
+	DUCKDB_SCALAR_FUNCTION(ThetaIntersectFun),
+	DUCKDB_AGGREGATE_FUNCTION(ThetaMergeFun),
+	DUCKDB_AGGREGATE_FUNCTION(ThetaSketchFun),
+	DUCKDB_SCALAR_FUNCTION(ThetaUnionFun),
 	DUCKDB_SCALAR_FUNCTION_SET(TimeBucketFun),
 	DUCKDB_SCALAR_FUNCTION(TimeTZSortKeyFun),
 	DUCKDB_SCALAR_FUNCTION_SET(TimezoneFun),
@@ -390,6 +401,7 @@ static const StaticFunctionDefinition internal_functions[] = {
 	DUCKDB_SCALAR_FUNCTION_SET(BitwiseXorFun),
 	DUCKDB_SCALAR_FUNCTION_SET(YearFun),
 	DUCKDB_SCALAR_FUNCTION_SET(YearWeekFun),
+	DUCKDB_SCALAR_FUNCTION(ZorderKeyFun),
 	DUCKDB_SCALAR_FUNCTION_SET(BitwiseOrFun),
 	DUCKDB_SCALAR_FUNCTION_SET(BitwiseNotFun),
 	FINAL_FUNCTION
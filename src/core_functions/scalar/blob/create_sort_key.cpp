@@ -2,6 +2,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/radix.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 
@@ -676,6 +677,109 @@ static void CreateSortKeyFunction(DataChunk &args, ExpressionState &state, Vecto
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Z-Order Key
+//===--------------------------------------------------------------------===//
+// The Z-order key interleaves the bits of the (normalized) sort keys of all inputs, so that rows that are ordered on
+// the key are clustered on all inputs at the same time instead of only on the first input
+static constexpr idx_t ZORDER_BYTES_PER_INPUT = sizeof(uint64_t);
+
+static void GetZOrderPrefixes(Vector &input, idx_t size, unsafe_vector<uint64_t> &prefixes) {
+	// construct the regular (ascending, nulls last) sort key of the input
+	OrderModifiers modifiers(OrderType::ASCENDING, OrderByNullType::NULLS_LAST);
+	SortKeyVectorData vector_data(input, size, modifiers);
+	SortKeyLengthInfo key_lengths(size);
+	GetSortKeyLength(vector_data, key_lengths);
+
+	Vector sort_keys(LogicalType::BLOB, size);
+	auto data_pointers = unique_ptr<data_ptr_t[]>(new data_ptr_t[size]);
+	PrepareSortData(sort_keys, size, key_lengths, data_pointers.get());
+	unsafe_vector<idx_t> offsets;
+	offsets.resize(size, 0);
+	SortKeyConstructInfo info(modifiers, offsets, data_pointers.get());
+	ConstructSortKey(vector_data, info);
+	FinalizeSortData(sort_keys, size);
+
+	// the prefix is formed by the first bytes of the key after the validity byte - NULL values sort last
+	auto keys = FlatVector::GetData<string_t>(sort_keys);
+	for (idx_t r = 0; r < size; r++) {
+		auto idx = vector_data.format.sel->get_index(r);
+		if (!vector_data.format.validity.RowIsValid(idx)) {
+			prefixes[r] = NumericLimits<uint64_t>::Maximum();
+			continue;
+		}
+		data_t prefix[ZORDER_BYTES_PER_INPUT];
+		memset(prefix, 0, ZORDER_BYTES_PER_INPUT);
+		auto key_data = const_data_ptr_cast(keys[r].GetData()) + 1;
+		auto key_size = MinValue<idx_t>(keys[r].GetSize() - 1, ZORDER_BYTES_PER_INPUT);
+		memcpy(prefix, key_data, key_size);
+		prefixes[r] = BSwap(Load<uint64_t>(prefix));
+	}
+}
+
+static void ZOrderKeyFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto count = args.size();
+	auto input_count = args.ColumnCount();
+
+	vector<unsafe_vector<uint64_t>> prefixes(input_count);
+	for (idx_t c = 0; c < input_count; c++) {
+		prefixes[c].resize(count);
+		GetZOrderPrefixes(args.data[c], count, prefixes[c]);
+	}
+
+	auto key_size = input_count * ZORDER_BYTES_PER_INPUT;
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t r = 0; r < count; r++) {
+		result_data[r] = StringVector::EmptyString(result, key_size);
+		auto key_data = data_ptr_cast(result_data[r].GetDataWriteable());
+		memset(key_data, 0, key_size);
+		// interleave the bits of the inputs, starting from the most significant bit
+		idx_t out_bit = 0;
+		for (idx_t bit = ZORDER_BYTES_PER_INPUT * 8; bit > 0; bit--) {
+			for (idx_t c = 0; c < input_count; c++, out_bit++) {
+				if ((prefixes[c][r] >> (bit - 1)) & 1) {
+					key_data[out_bit / 8] |= data_t(0x80 >> (out_bit % 8));
+				}
+			}
+		}
+		result_data[r].Finalize();
+	}
+	if (args.AllConstant()) {
+		result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
+unique_ptr<FunctionData> ZOrderKeyBind(ClientContext &context, ScalarFunction &bound_function,
+                                       vector<unique_ptr<Expression>> &arguments) {
+	for (auto &argument : arguments) {
+		// the key is built from the first bytes of the sort key, which depend on the width of the input type
+		// integers that fit in a BIGINT are widened to it, so equal values result in the same key regardless of type
+		switch (argument->return_type.id()) {
+		case LogicalTypeId::TINYINT:
+		case LogicalTypeId::SMALLINT:
+		case LogicalTypeId::INTEGER:
+		case LogicalTypeId::UTINYINT:
+		case LogicalTypeId::USMALLINT:
+		case LogicalTypeId::UINTEGER:
+			argument = BoundCastExpression::AddCastToType(context, std::move(argument), LogicalType::BIGINT);
+			break;
+		default:
+			break;
+		}
+		// push collations
+		ExpressionBinder::PushCollation(context, argument, argument->return_type, false);
+	}
+	return nullptr;
+}
+
+ScalarFunction ZorderKeyFun::GetFunction() {
+	ScalarFunction zorder_key_function("zorder_key", {LogicalType::ANY}, LogicalType::BLOB, ZOrderKeyFunction,
+	                                   ZOrderKeyBind);
+	zorder_key_function.varargs = LogicalType::ANY;
+	zorder_key_function.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	return zorder_key_function;
+}
+
 ScalarFunction CreateSortKeyFun::GetFunction() {
 	ScalarFunction sort_key_function("create_sort_key", {LogicalType::ANY}, LogicalType::BLOB, CreateSortKeyFunction,
 	                                 CreateSortKeyBind);
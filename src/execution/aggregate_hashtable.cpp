@@ -81,6 +81,12 @@ shared_ptr<ArenaAllocator> GroupedAggregateHashTable::GetAggregateAllocator() {
 	return aggregate_allocator;
 }
 
+shared_ptr<ArenaAllocator> GroupedAggregateHashTable::ReplaceAggregateAllocator() {
+	auto result = std::move(aggregate_allocator);
+	aggregate_allocator = make_shared_ptr<ArenaAllocator>(allocator);
+	return result;
+}
+
 GroupedAggregateHashTable::~GroupedAggregateHashTable() {
 	Destroy();
 }
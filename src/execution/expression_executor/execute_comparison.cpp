@@ -1,3 +1,4 @@
+#include "duckdb/common/simd/simd_kernels.hpp"
 #include "duckdb/common/uhugeint.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
@@ -84,6 +85,109 @@ static idx_t NestedSelectOperation(Vector &left, Vector &right, optional_ptr<con
                                    optional_ptr<SelectionVector> true_sel, optional_ptr<SelectionVector> false_sel,
                                    optional_ptr<ValidityMask> null_mask);
 
+//! The comparison of the SIMD kernels for an operator, for "flat <op> constant" and for "constant <op> flat"
+template <class OP>
+struct SIMDComparisonOperator;
+
+template <>
+struct SIMDComparisonOperator<duckdb::Equals> {
+	static constexpr SIMDComparison COMPARISON = SIMDComparison::EQUAL;
+	static constexpr SIMDComparison FLIPPED = SIMDComparison::EQUAL;
+};
+
+template <>
+struct SIMDComparisonOperator<duckdb::NotEquals> {
+	static constexpr SIMDComparison COMPARISON = SIMDComparison::NOT_EQUAL;
+	static constexpr SIMDComparison FLIPPED = SIMDComparison::NOT_EQUAL;
+};
+
+template <>
+struct SIMDComparisonOperator<duckdb::GreaterThan> {
+	static constexpr SIMDComparison COMPARISON = SIMDComparison::GREATER_THAN;
+	static constexpr SIMDComparison FLIPPED = SIMDComparison::LESS_THAN;
+};
+
+template <>
+struct SIMDComparisonOperator<duckdb::GreaterThanEquals> {
+	static constexpr SIMDComparison COMPARISON = SIMDComparison::GREATER_THAN_EQUALS;
+	static constexpr SIMDComparison FLIPPED = SIMDComparison::LESS_THAN_EQUALS;
+};
+
+//! The SIMD selection kernel for a type, if there is one that can compare against the constant
+template <class T>
+struct SIMDSelectKernel {
+	static simd_select_kernel_t<T> Get(T constant) {
+		return nullptr;
+	}
+};
+
+template <>
+struct SIMDSelectKernel<int32_t> {
+	static simd_select_kernel_t<int32_t> Get(int32_t constant) {
+		return SIMDKernels::Get().select_int32;
+	}
+};
+
+template <>
+struct SIMDSelectKernel<int64_t> {
+	static simd_select_kernel_t<int64_t> Get(int64_t constant) {
+		return SIMDKernels::Get().select_int64;
+	}
+};
+
+template <>
+struct SIMDSelectKernel<float> {
+	static simd_select_kernel_t<float> Get(float constant) {
+		return Value::IsNan(constant) ? nullptr : SIMDKernels::Get().select_float;
+	}
+};
+
+template <>
+struct SIMDSelectKernel<double> {
+	static simd_select_kernel_t<double> Get(double constant) {
+		return Value::IsNan(constant) ? nullptr : SIMDKernels::Get().select_double;
+	}
+};
+
+//! Comparisons between a flat vector without NULL values and a constant are executed with the SIMD kernels
+template <class T, class OP>
+static bool TrySIMDSelectOperation(Vector &left, Vector &right, optional_ptr<const SelectionVector> sel, idx_t count,
+                                   optional_ptr<SelectionVector> true_sel, optional_ptr<SelectionVector> false_sel,
+                                   idx_t &result) {
+	if (sel) {
+		return false;
+	}
+	auto flat = &left;
+	auto constant = &right;
+	auto comparison = SIMDComparisonOperator<OP>::COMPARISON;
+	if (left.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+		std::swap(flat, constant);
+		comparison = SIMDComparisonOperator<OP>::FLIPPED;
+	}
+	if (flat->GetVectorType() != VectorType::FLAT_VECTOR || constant->GetVectorType() != VectorType::CONSTANT_VECTOR ||
+	    ConstantVector::IsNull(*constant) || !FlatVector::Validity(*flat).AllValid()) {
+		return false;
+	}
+	auto constant_value = *ConstantVector::GetData<T>(*constant);
+	auto kernel = SIMDSelectKernel<T>::Get(constant_value);
+	if (!kernel) {
+		return false;
+	}
+	result = kernel(FlatVector::GetData<T>(*flat), constant_value, comparison, count,
+	                true_sel ? true_sel->data() : nullptr, false_sel ? false_sel->data() : nullptr);
+	return true;
+}
+
+template <class T, class OP>
+static idx_t TemplatedSelectNumeric(Vector &left, Vector &right, optional_ptr<const SelectionVector> sel, idx_t count,
+                                    optional_ptr<SelectionVector> true_sel, optional_ptr<SelectionVector> false_sel) {
+	idx_t result;
+	if (TrySIMDSelectOperation<T, OP>(left, right, sel, count, true_sel, false_sel, result)) {
+		return result;
+	}
+	return BinaryExecutor::Select<T, T, OP>(left, right, sel.get(), count, true_sel.get(), false_sel.get());
+}
+
 template <class OP>
 static idx_t TemplatedSelectOperation(Vector &left, Vector &right, optional_ptr<const SelectionVector> sel, idx_t count,
                                       optional_ptr<SelectionVector> true_sel, optional_ptr<SelectionVector> false_sel,
@@ -101,11 +205,9 @@ static idx_t TemplatedSelectOperation(Vector &left, Vector &right, optional_ptr<
 		return BinaryExecutor::Select<int16_t, int16_t, OP>(left, right, sel.get(), count, true_sel.get(),
 		                                                    false_sel.get());
 	case PhysicalType::INT32:
-		return BinaryExecutor::Select<int32_t, int32_t, OP>(left, right, sel.get(), count, true_sel.get(),
-		                                                    false_sel.get());
+		return TemplatedSelectNumeric<int32_t, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::INT64:
-		return BinaryExecutor::Select<int64_t, int64_t, OP>(left, right, sel.get(), count, true_sel.get(),
-		                                                    false_sel.get());
+		return TemplatedSelectNumeric<int64_t, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::UINT8:
 		return BinaryExecutor::Select<uint8_t, uint8_t, OP>(left, right, sel.get(), count, true_sel.get(),
 		                                                    false_sel.get());
@@ -125,10 +227,9 @@ static idx_t TemplatedSelectOperation(Vector &left, Vector &right, optional_ptr<
 		return BinaryExecutor::Select<uhugeint_t, uhugeint_t, OP>(left, right, sel.get(), count, true_sel.get(),
 		                                                          false_sel.get());
 	case PhysicalType::FLOAT:
-		return BinaryExecutor::Select<float, float, OP>(left, right, sel.get(), count, true_sel.get(), false_sel.get());
+		return TemplatedSelectNumeric<float, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::DOUBLE:
-		return BinaryExecutor::Select<double, double, OP>(left, right, sel.get(), count, true_sel.get(),
-		                                                  false_sel.get());
+		return TemplatedSelectNumeric<double, OP>(left, right, sel, count, true_sel, false_sel);
 	case PhysicalType::INTERVAL:
 		return BinaryExecutor::Select<interval_t, interval_t, OP>(left, right, sel.get(), count, true_sel.get(),
 		                                                          false_sel.get());
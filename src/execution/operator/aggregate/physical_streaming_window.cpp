@@ -1,13 +1,471 @@
 #include "duckdb/execution/operator/aggregate/physical_streaming_window.hpp"
 
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hugeint.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 
 namespace duckdb {
 
+//! Maintains an aggregate over a sliding ROWS frame (n PRECEDING AND CURRENT ROW) of a stream incrementally, without
+//! buffering more than the rows of the frame
+class StreamingWindowSlidingAggregate {
+public:
+	explicit StreamingWindowSlidingAggregate(idx_t preceding) : preceding(preceding), row_idx(0) {
+	}
+	virtual ~StreamingWindowSlidingAggregate() {
+	}
+
+	//! The number of preceding rows of a constant sliding ROWS frame, or DConstants::INVALID_INDEX
+	static idx_t GetPreceding(const BoundWindowExpression &wexpr);
+	static bool CanSlide(const BoundWindowExpression &wexpr);
+	static unique_ptr<StreamingWindowSlidingAggregate> Create(const BoundWindowExpression &wexpr,
+	                                                          ArenaAllocator &allocator);
+
+	//! Computes the aggregates of the frames that end at each of the rows of the payload
+	virtual void Execute(DataChunk &payload, Vector &result, idx_t count) = 0;
+
+protected:
+	//! Whether the row at the given position of the stream has left the frame of the row at row_idx
+	inline bool Evicted(idx_t row) const {
+		return row + preceding < row_idx;
+	}
+
+protected:
+	//! The number of rows that precede the current row in the frame
+	const idx_t preceding;
+	//! The position of the current row in the stream
+	idx_t row_idx;
+};
+
+//! Invertible aggregates (count, and sum and avg of integers): rows are added to and subtracted from a running total
+class StreamingWindowSlidingSum : public StreamingWindowSlidingAggregate {
+public:
+	enum class SlidingSumType : uint8_t { COUNT, SUM, AVG };
+
+	StreamingWindowSlidingSum(idx_t preceding, SlidingSumType sum_type)
+	    : StreamingWindowSlidingAggregate(preceding), sum_type(sum_type), total(0), valid_count(0) {
+	}
+
+	void Execute(DataChunk &payload, Vector &result, idx_t count) override {
+		if (payload.ColumnCount() == 0) {
+			// COUNT(*)
+			ExecuteInternal<int64_t>(nullptr, result, count);
+			return;
+		}
+		auto &input = payload.data[0];
+		switch (input.GetType().InternalType()) {
+		case PhysicalType::INT16:
+			ExecuteInternal<int16_t>(&input, result, count);
+			break;
+		case PhysicalType::INT32:
+			ExecuteInternal<int32_t>(&input, result, count);
+			break;
+		case PhysicalType::INT64:
+			ExecuteInternal<int64_t>(&input, result, count);
+			break;
+		default:
+			// COUNT of any other type only looks at the validity
+			D_ASSERT(sum_type == SlidingSumType::COUNT);
+			ExecuteInternal<int8_t>(&input, result, count);
+			break;
+		}
+	}
+
+private:
+	template <class T>
+	void ExecuteInternal(Vector *input, Vector &result, idx_t count) {
+		UnifiedVectorFormat vdata;
+		if (input) {
+			input->ToUnifiedFormat(count, vdata);
+		}
+		auto &result_mask = FlatVector::Validity(result);
+		for (idx_t i = 0; i < count; ++i, ++row_idx) {
+			// add the current row
+			SlidingValue entry;
+			if (input) {
+				const auto idx = vdata.sel->get_index(i);
+				entry.valid = vdata.validity.RowIsValid(idx);
+				if (entry.valid && sum_type != SlidingSumType::COUNT) {
+					entry.value = Hugeint::Convert(UnifiedVectorFormat::GetData<T>(vdata)[idx]);
+				}
+			}
+			Add(entry);
+			frame.push_back(entry);
+
+			// subtract the row that left the frame
+			if (Evicted(row_idx - frame.size() + 1)) {
+				Subtract(frame.front());
+				frame.pop_front();
+			}
+
+			switch (sum_type) {
+			case SlidingSumType::COUNT:
+				FlatVector::GetData<int64_t>(result)[i] = NumericCast<int64_t>(valid_count);
+				break;
+			case SlidingSumType::SUM:
+				if (!valid_count) {
+					result_mask.SetInvalid(i);
+					break;
+				}
+				FlatVector::GetData<hugeint_t>(result)[i] = total;
+				break;
+			case SlidingSumType::AVG:
+				if (!valid_count) {
+					result_mask.SetInvalid(i);
+					break;
+				}
+				// match the precision of the average aggregate
+				if (std::is_same<T, int16_t>::value) {
+					FlatVector::GetData<double>(result)[i] = Hugeint::Cast<double>(total) / double(valid_count);
+				} else {
+					FlatVector::GetData<double>(result)[i] =
+					    double(Hugeint::Cast<long double>(total) / (long double)(valid_count));
+				}
+				break;
+			}
+		}
+	}
+
+	struct SlidingValue {
+		hugeint_t value = 0;
+		bool valid = true;
+	};
+
+	inline void Add(const SlidingValue &entry) {
+		if (entry.valid) {
+			total += entry.value;
+			valid_count++;
+		}
+	}
+
+	inline void Subtract(const SlidingValue &entry) {
+		if (entry.valid) {
+			total -= entry.value;
+			valid_count--;
+		}
+	}
+
+private:
+	const SlidingSumType sum_type;
+	//! The values of the rows in the frame
+	deque<SlidingValue> frame;
+	hugeint_t total;
+	idx_t valid_count;
+};
+
+template <class T>
+struct SlidingMinMaxValue {
+	static inline T Get(Vector &input, UnifiedVectorFormat &vdata, idx_t i, idx_t idx) {
+		return UnifiedVectorFormat::GetData<T>(vdata)[idx];
+	}
+	static inline void Set(Vector &result, idx_t i, const T &value) {
+		FlatVector::GetData<T>(result)[i] = value;
+	}
+	template <class OP>
+	static inline bool Compare(const T &left, const T &right) {
+		return OP::Operation(left, right);
+	}
+};
+
+template <>
+struct SlidingMinMaxValue<Value> {
+	static inline Value Get(Vector &input, UnifiedVectorFormat &vdata, idx_t i, idx_t idx) {
+		return input.GetValue(i);
+	}
+	static inline void Set(Vector &result, idx_t i, const Value &value) {
+		result.SetValue(i, value);
+	}
+	template <class OP>
+	static inline bool Compare(const Value &left, const Value &right) {
+		return std::is_same<OP, LessThan>::value ? left < right : left > right;
+	}
+};
+
+//! MIN and MAX keep a monotonic deque of the rows of the frame that can still become the result: every value is
+//! followed only by values that compare worse, so the front of the deque is the result
+template <class T, class OP>
+class StreamingWindowSlidingMinMax : public StreamingWindowSlidingAggregate {
+public:
+	explicit StreamingWindowSlidingMinMax(idx_t preceding) : StreamingWindowSlidingAggregate(preceding) {
+	}
+
+	void Execute(DataChunk &payload, Vector &result, idx_t count) override {
+		D_ASSERT(payload.ColumnCount() == 1);
+		auto &input = payload.data[0];
+		UnifiedVectorFormat vdata;
+		input.ToUnifiedFormat(count, vdata);
+		for (idx_t i = 0; i < count; ++i, ++row_idx) {
+			const auto idx = vdata.sel->get_index(i);
+			if (vdata.validity.RowIsValid(idx)) {
+				auto value = SlidingMinMaxValue<T>::Get(input, vdata, i, idx);
+				while (!candidates.empty() &&
+				       !SlidingMinMaxValue<T>::template Compare<OP>(candidates.back().second, value)) {
+					candidates.pop_back();
+				}
+				candidates.emplace_back(row_idx, std::move(value));
+			}
+			while (!candidates.empty() && Evicted(candidates.front().first)) {
+				candidates.pop_front();
+			}
+			if (candidates.empty()) {
+				FlatVector::SetNull(result, i, true);
+				continue;
+			}
+			SlidingMinMaxValue<T>::Set(result, i, candidates.front().second);
+		}
+	}
+
+private:
+	//! The positions and values of the candidates in the frame
+	deque<std::pair<idx_t, T>> candidates;
+};
+
+template <class OP>
+static unique_ptr<StreamingWindowSlidingAggregate> CreateSlidingMinMax(PhysicalType type, idx_t preceding) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return make_uniq<StreamingWindowSlidingMinMax<int8_t, OP>>(preceding);
+	case PhysicalType::INT16:
+		return make_uniq<StreamingWindowSlidingMinMax<int16_t, OP>>(preceding);
+	case PhysicalType::INT32:
+		return make_uniq<StreamingWindowSlidingMinMax<int32_t, OP>>(preceding);
+	case PhysicalType::INT64:
+		return make_uniq<StreamingWindowSlidingMinMax<int64_t, OP>>(preceding);
+	case PhysicalType::INT128:
+		return make_uniq<StreamingWindowSlidingMinMax<hugeint_t, OP>>(preceding);
+	case PhysicalType::UINT8:
+		return make_uniq<StreamingWindowSlidingMinMax<uint8_t, OP>>(preceding);
+	case PhysicalType::UINT16:
+		return make_uniq<StreamingWindowSlidingMinMax<uint16_t, OP>>(preceding);
+	case PhysicalType::UINT32:
+		return make_uniq<StreamingWindowSlidingMinMax<uint32_t, OP>>(preceding);
+	case PhysicalType::UINT64:
+		return make_uniq<StreamingWindowSlidingMinMax<uint64_t, OP>>(preceding);
+	case PhysicalType::UINT128:
+		return make_uniq<StreamingWindowSlidingMinMax<uhugeint_t, OP>>(preceding);
+	case PhysicalType::FLOAT:
+		return make_uniq<StreamingWindowSlidingMinMax<float, OP>>(preceding);
+	case PhysicalType::DOUBLE:
+		return make_uniq<StreamingWindowSlidingMinMax<double, OP>>(preceding);
+	default:
+		// other types (strings, nested types, ...) are compared as values
+		return make_uniq<StreamingWindowSlidingMinMax<Value, OP>>(preceding);
+	}
+}
+
+//! Any other aggregate with a combine function uses two stacks: the rows that entered the frame are aggregated in a
+//! single state, and the oldest rows are kept as suffix aggregates that are popped when they leave the frame. When
+//! no suffix aggregates remain, the newer rows are turned into suffix aggregates, so every row is combined a constant
+//! number of times.
+class StreamingWindowSlidingCombine : public StreamingWindowSlidingAggregate {
+public:
+	using StateBuffer = vector<data_t>;
+
+	StreamingWindowSlidingCombine(idx_t preceding, const BoundWindowExpression &wexpr, ArenaAllocator &allocator)
+	    : StreamingWindowSlidingAggregate(preceding), aggregate(*wexpr.aggregate),
+	      aggr_input_data(wexpr.bind_info.get(), allocator), state_size(aggregate.state_size()),
+	      sourcev(LogicalType::POINTER, data_ptr_cast(&source_ptr)),
+	      targetv(LogicalType::POINTER, data_ptr_cast(&target_ptr)), statesv(LogicalType::POINTER) {
+		back_state = CreateState();
+		result_state.resize(state_size);
+	}
+
+	~StreamingWindowSlidingCombine() override {
+		for (auto &state : suffixes) {
+			Destroy(state);
+		}
+		for (auto &state : rows) {
+			Destroy(state);
+		}
+		Destroy(back_state);
+	}
+
+	void Execute(DataChunk &payload, Vector &result, idx_t count) override {
+		// aggregate every row into a state of its own
+		vector<StateBuffer> row_states;
+		row_states.reserve(count);
+		auto states = FlatVector::GetData<data_ptr_t>(statesv);
+		for (idx_t i = 0; i < count; ++i) {
+			row_states.emplace_back(CreateState());
+			states[i] = row_states.back().data();
+		}
+		aggregate.update(payload.data.data(), aggr_input_data, payload.ColumnCount(), statesv, count);
+
+		for (idx_t i = 0; i < count; ++i, ++row_idx) {
+			// the row enters the frame
+			Combine(row_states[i], back_state);
+			rows.emplace_back(std::move(row_states[i]));
+
+			// the oldest row leaves the frame
+			if (Evicted(row_idx - suffixes.size() - rows.size() + 1)) {
+				if (suffixes.empty()) {
+					Flip();
+				}
+				Destroy(suffixes.back());
+				suffixes.pop_back();
+			}
+
+			// the frame is the oldest suffix followed by the newer rows
+			target_ptr = result_state.data();
+			aggregate.initialize(target_ptr);
+			if (!suffixes.empty()) {
+				Combine(suffixes.back(), result_state);
+			}
+			Combine(back_state, result_state);
+			target_ptr = result_state.data();
+			aggregate.finalize(targetv, aggr_input_data, result, 1, i);
+			Destroy(result_state);
+		}
+	}
+
+private:
+	StateBuffer CreateState() {
+		StateBuffer state(state_size);
+		aggregate.initialize(state.data());
+		return state;
+	}
+
+	void Destroy(StateBuffer &state) {
+		if (aggregate.destructor) {
+			target_ptr = state.data();
+			aggregate.destructor(targetv, aggr_input_data, 1);
+		}
+	}
+
+	//! Combines the source into the target (the source rows precede the target rows if the target is empty)
+	void Combine(StateBuffer &source, StateBuffer &target) {
+		source_ptr = source.data();
+		target_ptr = target.data();
+		aggregate.combine(sourcev, targetv, aggr_input_data, 1);
+	}
+
+	//! Turns the rows that entered the frame into suffix aggregates, newest first
+	void Flip() {
+		D_ASSERT(suffixes.empty());
+		for (idx_t i = rows.size(); i-- > 0;) {
+			auto suffix = CreateState();
+			Combine(rows[i], suffix);
+			if (!suffixes.empty()) {
+				Combine(suffixes.back(), suffix);
+			}
+			Destroy(rows[i]);
+			suffixes.emplace_back(std::move(suffix));
+		}
+		rows.clear();
+		Destroy(back_state);
+		back_state = CreateState();
+	}
+
+private:
+	AggregateFunction &aggregate;
+	AggregateInputData aggr_input_data;
+	const idx_t state_size;
+	//! The aggregates of the oldest rows of the frame up to the newest of them, the oldest row is at the back
+	vector<StateBuffer> suffixes;
+	//! The rows that entered the frame after the suffix aggregates were built, and their aggregate
+	vector<StateBuffer> rows;
+	StateBuffer back_state;
+	//! The (uninitialized) state that the frame is combined into
+	StateBuffer result_state;
+
+	data_ptr_t source_ptr;
+	data_ptr_t target_ptr;
+	Vector sourcev;
+	Vector targetv;
+	Vector statesv;
+};
+
+//! Whether the aggregate is a sum or average of integers that can be maintained by adding and subtracting rows
+static bool IsInvertibleSum(const BoundWindowExpression &wexpr) {
+	const auto &name = wexpr.aggregate->name;
+	if ((name != "sum" && name != "avg") || wexpr.children.size() != 1) {
+		return false;
+	}
+	switch (wexpr.children[0]->return_type.id()) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		return wexpr.return_type.id() == (name == "sum" ? LogicalTypeId::HUGEINT : LogicalTypeId::DOUBLE);
+	default:
+		return false;
+	}
+}
+
+idx_t StreamingWindowSlidingAggregate::GetPreceding(const BoundWindowExpression &wexpr) {
+	if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS || wexpr.end != WindowBoundary::CURRENT_ROW_ROWS ||
+	    wexpr.start_expr->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return DConstants::INVALID_INDEX;
+	}
+	auto &value = wexpr.start_expr->Cast<BoundConstantExpression>().value;
+	if (value.IsNull() || !value.type().IsIntegral()) {
+		return DConstants::INVALID_INDEX;
+	}
+	const auto preceding = value.GetValue<int64_t>();
+	if (preceding < 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	return NumericCast<idx_t>(preceding);
+}
+
+bool StreamingWindowSlidingAggregate::CanSlide(const BoundWindowExpression &wexpr) {
+	if (GetPreceding(wexpr) == DConstants::INVALID_INDEX) {
+		return false;
+	}
+	auto &aggregate = *wexpr.aggregate;
+	const auto &name = aggregate.name;
+	if (name == "count_star") {
+		return wexpr.children.empty();
+	}
+	if (name == "count" || name == "min" || name == "max") {
+		return wexpr.children.size() == 1;
+	}
+	if (IsInvertibleSum(wexpr)) {
+		return true;
+	}
+	// holistic aggregates are not combined incrementally
+	return aggregate.update && aggregate.combine && aggregate.finalize && !aggregate.window;
+}
+
+unique_ptr<StreamingWindowSlidingAggregate> StreamingWindowSlidingAggregate::Create(const BoundWindowExpression &wexpr,
+                                                                                    ArenaAllocator &allocator) {
+	D_ASSERT(CanSlide(wexpr));
+	const auto preceding = GetPreceding(wexpr);
+	const auto &name = wexpr.aggregate->name;
+	using SlidingSumType = StreamingWindowSlidingSum::SlidingSumType;
+	if (name == "count_star" || name == "count") {
+		return make_uniq<StreamingWindowSlidingSum>(preceding, SlidingSumType::COUNT);
+	}
+	if (name == "min") {
+		return CreateSlidingMinMax<LessThan>(wexpr.return_type.InternalType(), preceding);
+	}
+	if (name == "max") {
+		return CreateSlidingMinMax<GreaterThan>(wexpr.return_type.InternalType(), preceding);
+	}
+	if (IsInvertibleSum(wexpr)) {
+		return make_uniq<StreamingWindowSlidingSum>(preceding,
+		                                            name == "sum" ? SlidingSumType::SUM : SlidingSumType::AVG);
+	}
+	return make_uniq<StreamingWindowSlidingCombine>(preceding, wexpr, allocator);
+}
+
+//! Whether the aggregate is a running total or an aggregate over a sliding frame that can be computed incrementally
+static bool IsStreamingAggregate(const BoundWindowExpression &wexpr) {
+	// TODO: Support FILTER and DISTINCT
+	if (wexpr.filter_expr || wexpr.distinct) {
+		return false;
+	}
+	if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+		return true;
+	}
+	return StreamingWindowSlidingAggregate::CanSlide(wexpr);
+}
+
 bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr) {
 	auto &wexpr = expr->Cast<BoundWindowExpression>();
 	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls ||
@@ -17,10 +475,8 @@ bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr)
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
 	case ExpressionType::WINDOW_AGGREGATE:
-		// We can stream aggregates if they are "running totals"
-		// TODO: Support FILTER and DISTINCT
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS &&
-		       !wexpr.filter_expr && !wexpr.distinct;
+		// We can stream aggregates if they are "running totals", or if they slide over a fixed number of rows
+		return IsStreamingAggregate(wexpr);
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -32,6 +488,32 @@ bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr)
 	}
 }
 
+bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr,
+                                                  const OutputOrderProperty &input_order) {
+	if (IsStreamingFunction(expr)) {
+		return true;
+	}
+	// ordered windows over the entire input can be streamed if the input is already sorted on the window order,
+	// as long as the result does not depend on peers or on rows that follow
+	auto &wexpr = expr->Cast<BoundWindowExpression>();
+	if (!wexpr.partitions.empty() || !input_order.Satisfies(wexpr.orders) || wexpr.ignore_nulls ||
+	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+	switch (wexpr.type) {
+	case ExpressionType::WINDOW_AGGREGATE:
+		return IsStreamingAggregate(wexpr);
+	case ExpressionType::WINDOW_FIRST_VALUE:
+		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING &&
+		       (wexpr.end == WindowBoundary::CURRENT_ROW_ROWS || wexpr.end == WindowBoundary::CURRENT_ROW_RANGE ||
+		        wexpr.end == WindowBoundary::UNBOUNDED_FOLLOWING);
+	case ExpressionType::WINDOW_ROW_NUMBER:
+		return true;
+	default:
+		return false;
+	}
+}
+
 PhysicalStreamingWindow::PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
                                                  idx_t estimated_cardinality, PhysicalOperatorType type)
     : PhysicalOperator(type, std::move(types), estimated_cardinality), select_list(std::move(select_list)) {
@@ -71,12 +553,17 @@ public:
 		aggregate_states.resize(expressions.size());
 		aggregate_bind_data.resize(expressions.size(), nullptr);
 		aggregate_dtors.resize(expressions.size(), nullptr);
+		sliding_aggregates.resize(expressions.size());
 
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
 			auto &wexpr = expr.Cast<BoundWindowExpression>();
 			switch (expr.GetExpressionType()) {
 			case ExpressionType::WINDOW_AGGREGATE: {
+				if (wexpr.start != WindowBoundary::UNBOUNDED_PRECEDING) {
+					sliding_aggregates[expr_idx] = StreamingWindowSlidingAggregate::Create(wexpr, allocator);
+					break;
+				}
 				auto &aggregate = *wexpr.aggregate;
 				auto &state = aggregate_states[expr_idx];
 				aggregate_bind_data[expr_idx] = wexpr.bind_info.get();
@@ -123,6 +610,8 @@ public:
 	vector<aggregate_destructor_t> aggregate_dtors;
 	data_ptr_t state_ptr;
 	Vector statev;
+	//! The aggregates over sliding frames
+	vector<unique_ptr<StreamingWindowSlidingAggregate>> sliding_aggregates;
 };
 
 unique_ptr<GlobalOperatorState> PhysicalStreamingWindow::GetGlobalOperatorState(ClientContext &context) const {
@@ -160,6 +649,27 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 			state.state_ptr = state.aggregate_states[expr_idx].data();
 			AggregateInputData aggr_input_data(wexpr.bind_info.get(), state.allocator);
 
+			// Compute the arguments
+			auto &allocator = Allocator::Get(context.client);
+			ExpressionExecutor executor(context.client);
+			vector<LogicalType> payload_types;
+			for (auto &child : wexpr.children) {
+				payload_types.push_back(child->return_type);
+				executor.AddExpression(*child);
+			}
+			DataChunk payload;
+			if (!payload_types.empty()) {
+				payload.Initialize(allocator, payload_types);
+				executor.Execute(input, payload);
+			}
+
+			// Aggregates over sliding frames maintain their own state
+			auto &sliding = state.sliding_aggregates[expr_idx];
+			if (sliding) {
+				sliding->Execute(payload, result, count);
+				break;
+			}
+
 			// Check for COUNT(*)
 			if (wexpr.children.empty()) {
 				D_ASSERT(GetTypeIdSize(result.GetType().InternalType()) == sizeof(int64_t));
@@ -171,19 +681,6 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 				break;
 			}
 
-			// Compute the arguments
-			auto &allocator = Allocator::Get(context.client);
-			ExpressionExecutor executor(context.client);
-			vector<LogicalType> payload_types;
-			for (auto &child : wexpr.children) {
-				payload_types.push_back(child->return_type);
-				executor.AddExpression(*child);
-			}
-
-			DataChunk payload;
-			payload.Initialize(allocator, payload_types);
-			executor.Execute(input, payload);
-
 			// Iterate through them using a single SV
 			payload.Flatten();
 			DataChunk row;
@@ -251,4 +748,9 @@ string PhysicalStreamingWindow::ParamsToString() const {
 	return result;
 }
 
+OutputOrderProperty PhysicalStreamingWindow::GetOutputOrder(ClientContext &context) const {
+	// the input columns are passed through at the same positions
+	return children[0]->GetOutputOrder(context);
+}
+
 } // namespace duckdb
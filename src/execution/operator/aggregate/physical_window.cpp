@@ -72,7 +72,9 @@ PhysicalWindow::PhysicalWindow(vector<LogicalType> types, vector<unique_ptr<Expr
     : PhysicalOperator(type, std::move(types), estimated_cardinality), select_list(std::move(select_list_p)),
       order_idx(0), is_order_dependent(false) {
 
-	idx_t max_orders = 0;
+	// the input is partitioned and sorted for the expression with the most sort keys (and the fewest partitions),
+	// the sort of all other expressions is a prefix of its sort
+	idx_t max_keys = 0;
 	for (idx_t i = 0; i < select_list.size(); ++i) {
 		auto &expr = select_list[i];
 		D_ASSERT(expr->expression_class == ExpressionClass::BOUND_WINDOW);
@@ -81,11 +83,19 @@ PhysicalWindow::PhysicalWindow(vector<LogicalType> types, vector<unique_ptr<Expr
 			is_order_dependent = true;
 		}
 
-		if (bound_window.orders.size() > max_orders) {
+		const auto keys = bound_window.partitions.size() + bound_window.orders.size();
+		auto &order_window = select_list[order_idx]->Cast<BoundWindowExpression>();
+		if (keys > max_keys || (keys == max_keys && bound_window.partitions.size() < order_window.partitions.size())) {
 			order_idx = i;
-			max_orders = bound_window.orders.size();
+			max_keys = keys;
 		}
 	}
+#ifdef DEBUG
+	auto &order_window = select_list[order_idx]->Cast<BoundWindowExpression>();
+	for (auto &expr : select_list) {
+		D_ASSERT(expr->Cast<BoundWindowExpression>().SortIsPrefixOf(order_window));
+	}
+#endif
 }
 
 static unique_ptr<WindowExecutor> WindowExecutorFactory(BoundWindowExpression &wexpr, ClientContext &context,
@@ -373,15 +383,24 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 	partition_mask.Initialize(count);
 	partition_mask.SetAllInvalid(count);
 
+	// Expressions with more partitions than the sort use the order mask of their partitions as partition mask
+	auto &order_window = op.select_list[op.order_idx]->Cast<BoundWindowExpression>();
+	const auto partition_count = order_window.partitions.size();
 	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
-		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
-		if (order_mask.IsMaskSet()) {
-			continue;
+		vector<idx_t> prefixes {wexpr.partitions.size() + wexpr.orders.size()};
+		if (wexpr.partitions.size() > partition_count) {
+			prefixes.push_back(wexpr.partitions.size());
+		}
+		for (const auto prefix : prefixes) {
+			auto &order_mask = order_masks[prefix];
+			if (order_mask.IsMaskSet()) {
+				continue;
+			}
+			order_mask.Initialize(count);
+			order_mask.SetAllInvalid(count);
 		}
-		order_mask.Initialize(count);
-		order_mask.SetAllInvalid(count);
 	}
 
 	// Scan the sorted data into new Collections
@@ -414,7 +433,9 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
 		auto &order_mask = order_masks[wexpr.partitions.size() + wexpr.orders.size()];
-		auto wexec = WindowExecutorFactory(wexpr, context, partition_mask, order_mask, count, gstate.mode);
+		auto &wexpr_partition_mask =
+		    wexpr.partitions.size() > partition_count ? order_masks[wexpr.partitions.size()] : partition_mask;
+		auto wexec = WindowExecutorFactory(wexpr, context, wexpr_partition_mask, order_mask, count, gstate.mode);
 		executors.emplace_back(std::move(wexec));
 	}
 
@@ -52,7 +52,9 @@ shared_ptr<CSVBuffer> CSVBuffer::Next(CSVFileHandle &file_handle, idx_t buffer_s
 
 void CSVBuffer::AllocateBuffer(idx_t buffer_size) {
 	auto &buffer_manager = BufferManager::GetBufferManager(context);
-	bool can_destroy = !is_pipe;
+	// Buffers of pipes and compressed files can not be re-read from the file, so they can not be destroyed
+	// They are released by the buffer manager once all scanners are done with them
+	bool can_destroy = can_seek;
 	handle = buffer_manager.Allocate(MemoryTag::CSV_READER, MaxValue<idx_t>(Storage::BLOCK_SIZE, buffer_size),
 	                                 can_destroy, &block);
 }
@@ -70,7 +72,7 @@ void CSVBuffer::Reload(CSVFileHandle &file_handle) {
 
 shared_ptr<CSVBufferHandle> CSVBuffer::Pin(CSVFileHandle &file_handle, bool &has_seeked) {
 	auto &buffer_manager = BufferManager::GetBufferManager(context);
-	if (!is_pipe && block->IsUnloaded()) {
+	if (can_seek && block->IsUnloaded()) {
 		// We have to reload it from disk
 		block = nullptr;
 		Reload(file_handle);
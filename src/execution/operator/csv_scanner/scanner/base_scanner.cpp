@@ -16,6 +16,10 @@ BaseScanner::BaseScanner(shared_ptr<CSVBufferManager> buffer_manager_p, shared_p
       state_machine(std::move(state_machine_p)), iterator(iterator_p), buffer_manager(std::move(buffer_manager_p)) {
 	D_ASSERT(buffer_manager);
 	D_ASSERT(state_machine);
+	auto &kernels = SIMDKernels::Get();
+	if (kernels.level != SIMDLevel::SCALAR) {
+		match_bytes = kernels.match_bytes;
+	}
 	// Initialize current buffer handle
 	cur_buffer_handle = buffer_manager->GetBuffer(iterator.GetBufferIdx());
 	if (!cur_buffer_handle) {
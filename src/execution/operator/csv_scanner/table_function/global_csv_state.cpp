@@ -4,6 +4,7 @@
 #include "duckdb/execution/operator/csv_scanner/csv_sniffer.hpp"
 #include "duckdb/execution/operator/persistent/csv_rejects_table.hpp"
 #include "duckdb/main/appender.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -132,6 +133,15 @@ idx_t CSVGlobalState::MaxThreads() const {
 	if (single_threaded) {
 		return system_threads;
 	}
+	if (!file_scans.back()->buffer_manager->file_handle->CanSeek()) {
+		// We don't know how much data a pipe or a compressed file holds: buffers are read from the stream one at a time
+		// (holding the buffer manager lock), and the threads parse the buffers that were read in parallel
+		// These buffers can not be evicted, so the buffers in flight may take up at most half of the memory limit
+		auto &buffer_manager = *file_scans.back()->buffer_manager;
+		auto max_buffers = BufferManager::GetBufferManager(context).GetQueryMaxMemory() / 2 /
+		                   MaxValue<idx_t>(buffer_manager.GetBufferSize(), 1);
+		return MaxValue<idx_t>(MinValue<idx_t>(system_threads, max_buffers), 1);
+	}
 	idx_t total_threads = file_scans.back()->file_size / CSVIterator::BYTES_PER_THREAD + 1;
 
 	if (total_threads < system_threads) {
@@ -59,4 +59,8 @@ string PhysicalFilter::ParamsToString() const {
 	return result;
 }
 
+OutputOrderProperty PhysicalFilter::GetOutputOrder(ClientContext &context) const {
+	return children[0]->GetOutputOrder(context);
+}
+
 } // namespace duckdb
@@ -88,7 +88,8 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
 	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
-	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	    : op(op), context(context_p),
+	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_update_count(0),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      scanned_data(false) {
@@ -107,8 +108,11 @@ public:
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Reports the size of the pointer table that was just initialized to the profiler
+	void AddHashTableMetrics();
 
 public:
+	const PhysicalHashJoin &op;
 	ClientContext &context;
 
 	const idx_t num_threads;
@@ -359,10 +363,23 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 		return;
 	}
 	hash_table->InitializePointerTable();
+	AddHashTableMetrics();
 	auto new_event = make_shared_ptr<HashJoinFinalizeEvent>(pipeline, *this);
 	event.InsertEvent(std::move(new_event));
 }
 
+void HashJoinGlobalSinkState::AddHashTableMetrics() {
+	auto &profiler = QueryProfiler::Get(context);
+	if (!profiler.IsEnabled()) {
+		return;
+	}
+	OperatorMetrics metrics;
+	metrics.hash_table_entries = hash_table->Count();
+	metrics.hash_table_capacity = JoinHashTable::PointerTableCapacity(hash_table->Count());
+	metrics.peak_memory = temporary_memory_state->GetReservation();
+	profiler.AddMetrics(op, metrics);
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	lock_guard<mutex> guard(lock);
 	if (!probe_spill) {
@@ -820,6 +837,7 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + num_threads - 1) / num_threads, 1);
 
 	ht.InitializePointerTable();
+	sink.AddHashTableMetrics();
 
 	global_stage = HashJoinSourceStage::BUILD;
 }
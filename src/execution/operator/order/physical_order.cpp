@@ -1,7 +1,9 @@
 #include "duckdb/execution/operator/order/physical_order.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/base_pipeline_event.hpp"
 #include "duckdb/parallel/executor_task.hpp"
@@ -279,4 +281,22 @@ string PhysicalOrder::ParamsToString() const {
 	return result;
 }
 
+OutputOrderProperty PhysicalOrder::GetOutputOrder(ClientContext &context) const {
+	OutputOrderProperty result;
+	result.global = true;
+	for (auto &order : orders) {
+		// only plain columns that are projected out can be referenced
+		if (order.expression->type != ExpressionType::BOUND_REF) {
+			break;
+		}
+		auto index = order.expression->Cast<BoundReferenceExpression>().index;
+		auto entry = std::find(projections.begin(), projections.end(), index);
+		if (entry == projections.end()) {
+			break;
+		}
+		result.keys.emplace_back(NumericCast<idx_t>(entry - projections.begin()), order.type, order.null_order);
+	}
+	return result;
+}
+
 } // namespace duckdb
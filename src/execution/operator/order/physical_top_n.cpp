@@ -84,7 +84,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to limit + offset entries if it has grown large enough, returns true if the heap was reduced
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +276,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +307,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,6 +409,11 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+
+	//! Protects the boundary value
+	mutex boundary_lock;
+	//! The tightest boundary value of any of the (local) heaps, that the dynamic filter is set to
+	Value boundary_value;
 };
 
 class TopNLocalState : public LocalSinkState {
@@ -424,6 +431,10 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		// the plan can be executed multiple times: clear the filter of the previous execution
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
@@ -434,10 +445,32 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter) {
+		UpdateDynamicFilter(input.global_state.Cast<TopNGlobalState>(), sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalTopN::UpdateDynamicFilter(GlobalSinkState &gstate_p, TopNHeap &heap) const {
+	auto &gstate = gstate_p.Cast<TopNGlobalState>();
+	// no row that sorts after the boundary of any of the local heaps can make it into the final result
+	auto boundary_value = heap.boundary_values.GetValue(0, 0);
+	if (boundary_value.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> l(gstate.boundary_lock);
+	if (!gstate.boundary_value.IsNull()) {
+		bool is_tighter = orders[0].type == OrderType::ASCENDING
+		                      ? ValueOperations::LessThan(boundary_value, gstate.boundary_value)
+		                      : ValueOperations::GreaterThan(boundary_value, gstate.boundary_value);
+		if (!is_tighter) {
+			return;
+		}
+	}
+	gstate.boundary_value = boundary_value;
+	dynamic_filter->SetValue(std::move(boundary_value));
+}
+
 //===--------------------------------------------------------------------===//
 // Combine
 //===--------------------------------------------------------------------===//
@@ -142,7 +142,7 @@ public:
 	atomic<bool> optimistically_written;
 	idx_t minimum_memory_per_thread;
 
-	static bool ReadyToMerge(idx_t count);
+	bool ReadyToMerge(idx_t count);
 	void ScheduleMergeTasks(idx_t min_batch_index);
 	unique_ptr<RowGroupCollection> MergeCollections(ClientContext &context,
 	                                                vector<RowGroupBatchEntry> merge_collections,
@@ -228,19 +228,20 @@ struct BatchMergeTask {
 
 bool BatchInsertGlobalState::ReadyToMerge(idx_t count) {
 	// we try to merge so the count fits nicely into row groups
-	if (count >= Storage::ROW_GROUP_SIZE / 10 * 9 && count <= Storage::ROW_GROUP_SIZE) {
+	auto row_group_size = table.GetStorage().GetRowGroupSize();
+	if (count >= row_group_size / 10 * 9 && count <= row_group_size) {
 		// 90%-100% of row group size
 		return true;
 	}
-	if (count >= Storage::ROW_GROUP_SIZE / 10 * 18 && count <= Storage::ROW_GROUP_SIZE * 2) {
+	if (count >= row_group_size / 10 * 18 && count <= row_group_size * 2) {
 		// 180%-200% of row group size
 		return true;
 	}
-	if (count >= Storage::ROW_GROUP_SIZE / 10 * 27 && count <= Storage::ROW_GROUP_SIZE * 3) {
+	if (count >= row_group_size / 10 * 27 && count <= row_group_size * 3) {
 		// 270%-300% of row group size
 		return true;
 	}
-	if (count >= Storage::ROW_GROUP_SIZE / 10 * 36) {
+	if (count >= row_group_size / 10 * 36) {
 		// >360% of row group size
 		return true;
 	}
@@ -345,7 +346,8 @@ void BatchInsertGlobalState::AddCollection(ClientContext &context, idx_t batch_i
 		                        batch_index, min_batch_index);
 	}
 	auto new_count = current_collection->GetTotalRows();
-	auto batch_type = new_count < Storage::ROW_GROUP_SIZE ? RowGroupBatchType::NOT_FLUSHED : RowGroupBatchType::FLUSHED;
+	auto batch_type =
+	    new_count < current_collection->GetRowGroupSize() ? RowGroupBatchType::NOT_FLUSHED : RowGroupBatchType::FLUSHED;
 	if (batch_type == RowGroupBatchType::FLUSHED && writer) {
 		writer->WriteLastRowGroup(*current_collection);
 	}
@@ -550,7 +552,7 @@ SinkFinalizeType PhysicalBatchInsert::Finalize(Pipeline &pipeline, Event &event,
 	auto &gstate = input.global_state.Cast<BatchInsertGlobalState>();
 	auto &memory_manager = gstate.memory_manager;
 
-	if (gstate.optimistically_written || gstate.insert_count >= LocalStorage::MERGE_THRESHOLD) {
+	if (gstate.optimistically_written || gstate.insert_count >= gstate.table.GetStorage().GetRowGroupSize()) {
 		// we have written data to disk optimistically or are inserting a large amount of data
 		// perform a final pass over all of the row groups and merge them together
 		vector<unique_ptr<CollectionMerger>> mergers;
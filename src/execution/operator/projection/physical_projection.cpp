@@ -1,6 +1,7 @@
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
@@ -77,4 +78,42 @@ string PhysicalProjection::ParamsToString() const {
 	return extra_info;
 }
 
+//! Returns the input column of an expression that preserves its order, if any
+static optional_idx OrderPreservingInput(const Expression &expr) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		return expr.Cast<BoundReferenceExpression>().index;
+	}
+	if (expr.type == ExpressionType::BOUND_FUNCTION) {
+		// compressed materialization compresses the keys of sorts, so its compression functions preserve the order
+		auto &func = expr.Cast<BoundFunctionExpression>();
+		if (StringUtil::StartsWith(func.function.name, "__internal_compress_") && !func.children.empty() &&
+		    func.children[0]->type == ExpressionType::BOUND_REF) {
+			return func.children[0]->Cast<BoundReferenceExpression>().index;
+		}
+	}
+	return optional_idx();
+}
+
+OutputOrderProperty PhysicalProjection::GetOutputOrder(ClientContext &context) const {
+	// the order survives for the keys that are passed through unchanged (or compressed)
+	auto child_order = children[0]->GetOutputOrder(context);
+	OutputOrderProperty result;
+	result.global = child_order.global;
+	for (auto &key : child_order.keys) {
+		optional_idx output_index;
+		for (idx_t i = 0; i < select_list.size(); i++) {
+			auto input_index = OrderPreservingInput(*select_list[i]);
+			if (input_index.IsValid() && input_index.GetIndex() == key.column_index) {
+				output_index = i;
+				break;
+			}
+		}
+		if (!output_index.IsValid()) {
+			break;
+		}
+		result.keys.emplace_back(output_index.GetIndex(), key.type, key.null_order);
+	}
+	return result;
+}
+
 } // namespace duckdb
@@ -30,6 +30,15 @@ PhysicalTableInOutFunction::PhysicalTableInOutFunction(vector<LogicalType> types
       projected_input(std::move(project_input_p)) {
 }
 
+string PhysicalTableInOutFunction::ParamsToString() const {
+	string result = function.name;
+	if (function.to_string) {
+		result += "\n[INFOSEPARATOR]\n";
+		result += function.to_string(bind_data.get());
+	}
+	return result;
+}
+
 unique_ptr<OperatorState> PhysicalTableInOutFunction::GetOperatorState(ExecutionContext &context) const {
 	auto &gstate = op_state->Cast<TableInOutGlobalState>();
 	auto result = make_uniq<TableInOutLocalState>();
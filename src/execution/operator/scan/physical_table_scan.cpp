@@ -1,8 +1,10 @@
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 
-#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
 #include <utility>
@@ -166,4 +168,45 @@ bool PhysicalTableScan::Equals(const PhysicalOperator &other_p) const {
 	return true;
 }
 
+OutputOrderProperty PhysicalTableScan::GetOutputOrder(ClientContext &context) const {
+	// the order of a table with sort keys is only reported if it holds across the entire scan:
+	// every row group is sorted, the row groups do not overlap, and nothing was appended locally
+	// index scans fetch rows from all over the table, so only a sequential scan of the table qualifies
+	OutputOrderProperty result;
+	if (function.name != "seq_scan" || !function.get_bind_info || !bind_data) {
+		return result;
+	}
+	auto table = function.get_bind_info(bind_data.get()).table;
+	if (!table || !table->IsDuckTable() || bind_data->Cast<TableScanBindData>().is_index_scan) {
+		return result;
+	}
+	auto &storage = table->Cast<DuckTableEntry>().GetStorage();
+	if (LocalStorage::Get(context, table->catalog).Find(storage)) {
+		return result;
+	}
+	auto global_keys = storage.GetGloballySortedKeyCount();
+	auto &sort_keys = storage.GetSortKeys();
+	auto &columns = table->GetColumns();
+	for (idx_t key_idx = 0; key_idx < MinValue(global_keys, sort_keys.size()); key_idx++) {
+		auto &key = sort_keys[key_idx];
+		optional_idx output_index;
+		for (idx_t i = 0; i < types.size(); i++) {
+			auto column_id = column_ids[projection_ids.empty() ? i : projection_ids[i]];
+			if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+				continue;
+			}
+			if (columns.GetColumn(LogicalIndex(column_id)).Physical() == key.column) {
+				output_index = i;
+				break;
+			}
+		}
+		if (!output_index.IsValid()) {
+			break;
+		}
+		result.keys.emplace_back(output_index.GetIndex(), key.type, key.null_order);
+	}
+	result.global = !result.keys.empty();
+	return result;
+}
+
 } // namespace duckdb
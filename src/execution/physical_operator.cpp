@@ -9,11 +9,31 @@
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/bound_result_modifier.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 namespace duckdb {
 
+bool OutputOrderProperty::Satisfies(const vector<BoundOrderByNode> &orders) const {
+	if (!global || orders.empty() || orders.size() > keys.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto &order = orders[i];
+		auto &key = keys[i];
+		if (order.expression->type != ExpressionType::BOUND_REF ||
+		    order.expression->Cast<BoundReferenceExpression>().index != key.column_index) {
+			return false;
+		}
+		if (order.type != key.type || order.null_order != key.null_order) {
+			return false;
+		}
+	}
+	return true;
+}
+
 string PhysicalOperator::GetName() const {
 	return PhysicalOperatorToString(type);
 }
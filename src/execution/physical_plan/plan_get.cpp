@@ -33,8 +33,17 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalGet &op) {
 	if (!op.children.empty()) {
 		// this is for table producing functions that consume subquery results
 		D_ASSERT(op.children.size() == 1);
-		auto node = make_uniq<PhysicalTableInOutFunction>(op.types, op.function, std::move(op.bind_data), op.column_ids,
-		                                                  op.estimated_cardinality, std::move(op.projected_input));
+		auto column_ids = op.column_ids;
+		if (!op.projection_ids.empty()) {
+			// only the projected columns are produced by the function
+			column_ids.clear();
+			for (auto &projection_id : op.projection_ids) {
+				column_ids.push_back(op.column_ids[projection_id]);
+			}
+		}
+		auto node = make_uniq<PhysicalTableInOutFunction>(op.types, op.function, std::move(op.bind_data),
+		                                                  std::move(column_ids), op.estimated_cardinality,
+		                                                  std::move(op.projected_input));
 		node->children.push_back(CreatePlan(std::move(op.children[0])));
 		return std::move(node);
 	}
@@ -1,9 +1,46 @@
 #include "duckdb/execution/operator/order/physical_order.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
 
 namespace duckdb {
 
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanPresortedOrder(unique_ptr<PhysicalOperator> plan,
+                                                                     const vector<idx_t> &projections) {
+	// the order of the input relies on the data (e.g. a sorted table), so the plan cannot be reused
+	requires_rebind = true;
+
+	// the source has to be scanned in order
+	reference<PhysicalOperator> source(*plan);
+	while (!source.get().IsSource()) {
+		D_ASSERT(source.get().children.size() == 1);
+		source = *source.get().children[0];
+	}
+	if (source.get().type == PhysicalOperatorType::TABLE_SCAN) {
+		source.get().Cast<PhysicalTableScan>().fixed_order = true;
+	}
+
+	bool projection_necessary = projections.size() != plan->types.size();
+	for (idx_t i = 0; i < projections.size() && !projection_necessary; i++) {
+		projection_necessary = projections[i] != i;
+	}
+	if (!projection_necessary) {
+		return plan;
+	}
+	vector<LogicalType> types;
+	vector<unique_ptr<Expression>> select_list;
+	for (auto &projection : projections) {
+		types.push_back(plan->types[projection]);
+		select_list.push_back(make_uniq<BoundReferenceExpression>(plan->types[projection], projection));
+	}
+	auto projection =
+	    make_uniq<PhysicalProjection>(std::move(types), std::move(select_list), plan->estimated_cardinality);
+	projection->children.push_back(std::move(plan));
+	return std::move(projection);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op) {
 	D_ASSERT(op.children.size() == 1);
 
@@ -17,6 +54,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOrder &op)
 		} else {
 			projections = std::move(op.projections);
 		}
+		if (plan->GetOutputOrder(context).Satisfies(op.orders)) {
+			// the input is already sorted: preserve its order instead of sorting it again
+			return PlanPresortedOrder(std::move(plan), projections);
+		}
 		auto order =
 		    make_uniq<PhysicalOrder>(op.types, std::move(op.orders), std::move(projections), op.estimated_cardinality);
 		order->children.push_back(std::move(plan));
@@ -13,6 +13,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalPrepare &o
 		auto plan = CreatePlan(*op.children[0]);
 		op.prepared->types = plan->types;
 		op.prepared->plan = std::move(plan);
+		if (requires_rebind) {
+			// the plan relies on the data (e.g. a sorted table): plan the statement again on every execution
+			op.prepared->properties.always_require_rebind = true;
+		}
 	}
 
 	return make_uniq<PhysicalPrepare>(op.name, std::move(op.prepared), op.estimated_cardinality);
@@ -28,11 +28,21 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 	types.resize(input_width);
 
 	// Identify streaming windows
+	// Windows ordered on the order of a sorted input can only stream if no blocking window reorders the rows first
+	auto input_order = plan->GetOutputOrder(context);
+	bool all_streaming = true;
+	for (auto &expr : op.expressions) {
+		all_streaming = all_streaming && PhysicalStreamingWindow::IsStreamingFunction(expr, input_order);
+	}
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
 		if (PhysicalStreamingWindow::IsStreamingFunction(op.expressions[expr_idx])) {
 			streaming_windows.push_back(expr_idx);
+		} else if (all_streaming) {
+			// the order of the input relies on the data, so the plan cannot be reused
+			requires_rebind = true;
+			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
 		}
@@ -48,8 +58,23 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 		auto &remaining = process_streaming ? streaming_windows : blocking_windows;
 		blocking_count += process_streaming ? 0 : 1;
 
-		// Find all functions that share the partitioning of the first remaining expression
+		// Find the expression whose sort can be shared by the most remaining expressions: expressions with finer
+		// partitions or shorter orders are evaluated over its sort instead of partitioning and sorting again
 		auto over_idx = remaining[0];
+		idx_t max_shared = 0;
+		for (const auto &candidate_idx : remaining) {
+			auto &candidate = op.expressions[candidate_idx]->Cast<BoundWindowExpression>();
+			idx_t shared = 0;
+			for (const auto &expr_idx : remaining) {
+				auto &wexpr = op.expressions[expr_idx]->Cast<BoundWindowExpression>();
+				shared += wexpr.SortIsPrefixOf(candidate);
+			}
+			if (shared > max_shared) {
+				over_idx = candidate_idx;
+				max_shared = shared;
+			}
+		}
+		const auto &over_expr = op.expressions[over_idx]->Cast<BoundWindowExpression>();
 
 		vector<idx_t> matching;
 		vector<idx_t> unprocessed;
@@ -57,15 +82,8 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 			D_ASSERT(op.expressions[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 			auto &wexpr = op.expressions[expr_idx]->Cast<BoundWindowExpression>();
 
-			// Just record the first one (it defines the partition)
-			if (over_idx == expr_idx) {
-				matching.emplace_back(expr_idx);
-				continue;
-			}
-
-			// If it is in a different partition, skip it
-			const auto &over_expr = op.expressions[over_idx]->Cast<BoundWindowExpression>();
-			if (!over_expr.PartitionsAreEquivalent(wexpr)) {
+			// If it can not be evaluated over the sort, skip it
+			if (!wexpr.SortIsPrefixOf(over_expr)) {
 				unprocessed.emplace_back(expr_idx);
 				continue;
 			}
@@ -84,19 +102,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalWindow &op
 			if (cse) {
 				continue;
 			}
-
-			// Is there a common sort prefix?
-			const auto prefix = over_expr.GetSharedOrders(wexpr);
-			if (prefix != MinValue<idx_t>(over_expr.orders.size(), wexpr.orders.size())) {
-				unprocessed.emplace_back(expr_idx);
-				continue;
-			}
 			matching.emplace_back(expr_idx);
-
-			// Switch to the longer prefix
-			if (prefix < wexpr.orders.size()) {
-				over_idx = expr_idx;
-			}
 		}
 		remaining.swap(unprocessed);
 
@@ -8,6 +8,7 @@
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/operator_metrics.hpp"
 #include "duckdb/parallel/event.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
@@ -369,7 +370,9 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 
 	// Check if we're approaching the memory limit
 	auto &temporary_memory_state = *gstate.temporary_memory_state;
-	const auto total_size = partitioned_data->SizeInBytes() + ht.Capacity() * sizeof(aggr_ht_entry_t);
+	// The size includes the arena of the aggregate states, which holds e.g. the values of holistic aggregates
+	const auto total_size = partitioned_data->SizeInBytes() + ht.Capacity() * sizeof(aggr_ht_entry_t) +
+	                        ht.GetAggregateAllocator()->AllocationSize();
 	idx_t thread_limit = temporary_memory_state.GetReservation() / gstate.number_of_threads;
 	if (total_size > thread_limit) {
 		// We're over the thread memory limit
@@ -400,6 +403,10 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 			partitioned_data->Repartition(*lstate.abandoned_data);
 			ht.SetRadixBits(gstate.config.GetRadixBits());
 			ht.InitializePartitionedData();
+			// The abandoned states still point into the arena, hand it over to the global state and start a new one
+			auto abandoned_allocator = ht.ReplaceAggregateAllocator();
+			lock_guard<mutex> guard(gstate.lock);
+			gstate.stored_allocators.emplace_back(std::move(abandoned_allocator));
 			return true;
 		}
 	}
@@ -486,6 +493,15 @@ void RadixPartitionedHashTable::Combine(ExecutionContext &context, GlobalSinkSta
 	MaybeRepartition(context.client, gstate, lstate);
 
 	auto &ht = *lstate.ht;
+	if (!gstate.external && gstate.number_of_threads == 1) {
+		// This HT is scanned without being finalized (see Finalize), so it is the one we report
+		auto metrics = OperatorMetrics::Active();
+		if (metrics) {
+			metrics->hash_table_entries += ht.Count();
+			metrics->hash_table_capacity += ht.Capacity();
+			metrics->peak_memory = MaxValue(metrics->peak_memory, gstate.temporary_memory_state->GetReservation());
+		}
+	}
 	ht.UnpinData();
 
 	if (lstate.abandoned_data) {
@@ -742,6 +758,13 @@ void RadixHTLocalSourceState::Finalize(RadixHTGlobalSinkState &sink, RadixHTGlob
 	ht->UnpinData();
 	partition.progress = 1;
 
+	auto metrics = OperatorMetrics::Active();
+	if (metrics) {
+		metrics->hash_table_entries += ht->Count();
+		metrics->hash_table_capacity += ht->Capacity();
+		metrics->peak_memory = MaxValue(metrics->peak_memory, sink.temporary_memory_state->GetReservation());
+	}
+
 	// Move the combined data back to the partition
 	partition.data =
 	    make_uniq<TupleDataCollection>(BufferManager::GetBufferManager(gstate.context), sink.radix_ht.GetLayout());
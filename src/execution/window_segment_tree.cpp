@@ -6,7 +6,9 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
+#include <condition_variable>
 #include <numeric>
 #include <utility>
 
@@ -598,8 +600,9 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
-                                     const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+                                     const WindowExcludeMode exclude_mode_p, idx_t count, ClientContext &context)
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), context(context), internal_nodes(0),
+      mode(mode_p) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
@@ -837,6 +840,93 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 	}
 }
 
+//! The construction of a level of the segment tree, which is split up into chunks of nodes
+class WindowSegmentTreeLevelBuild {
+public:
+	WindowSegmentTreeLevelBuild(WindowSegmentTree &tree, idx_t level, idx_t level_nodes, idx_t chunk_count)
+	    : tree(tree), level(level), level_nodes(level_nodes),
+	      chunk_nodes((level_nodes + chunk_count - 1) / chunk_count), chunk_count(chunk_count), next_chunk(0),
+	      chunks_completed(0) {
+	}
+
+	//! Constructs unclaimed chunks until there are none left
+	void Build(WindowSegmentTreePart &part) {
+		for (auto chunk_idx = next_chunk++; chunk_idx < chunk_count; chunk_idx = next_chunk++) {
+			const auto begin = chunk_idx * chunk_nodes;
+			const auto end = MinValue(level_nodes, begin + chunk_nodes);
+			ErrorData chunk_error;
+			try {
+				tree.ConstructNodes(part, level, begin, end);
+			} catch (std::exception &ex) {
+				chunk_error = ErrorData(ex);
+			} catch (...) {
+				chunk_error = ErrorData("Unknown exception while constructing the window segment tree");
+			}
+			lock_guard<mutex> guard(lock);
+			if (chunk_error.HasError()) {
+				error = std::move(chunk_error);
+			}
+			if (++chunks_completed == chunk_count) {
+				finished.notify_all();
+			}
+		}
+	}
+
+	//! Blocks until the chunks that were claimed by other threads are constructed
+	void Wait() {
+		unique_lock<mutex> guard(lock);
+		finished.wait(guard, [&]() { return chunks_completed == chunk_count; });
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+
+private:
+	WindowSegmentTree &tree;
+	const idx_t level;
+	const idx_t level_nodes;
+	const idx_t chunk_nodes;
+	const idx_t chunk_count;
+	//! The next chunk to construct
+	atomic<idx_t> next_chunk;
+
+	mutex lock;
+	//! Signalled when the last chunk is constructed
+	std::condition_variable finished;
+	idx_t chunks_completed;
+	ErrorData error;
+};
+
+//! Helps constructing a level of the segment tree, if there are chunks left when it is executed
+class WindowSegmentTreeBuildTask : public Task {
+public:
+	WindowSegmentTreeBuildTask(shared_ptr<WindowSegmentTreeLevelBuild> build_p, WindowSegmentTreePart &part)
+	    : build(std::move(build_p)), part(part) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		build->Build(part);
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	shared_ptr<WindowSegmentTreeLevelBuild> build;
+	WindowSegmentTreePart &part;
+};
+
+void WindowSegmentTree::ConstructNodes(WindowSegmentTreePart &part, idx_t level, idx_t begin, idx_t end) {
+	// level 0 is data itself
+	const auto level_size = level == 0 ? inputs.size() : levels_flat_start[level] - levels_flat_start[level - 1];
+	for (idx_t node = begin; node < end; ++node) {
+		// compute the aggregate for this entry in the segment tree
+		data_ptr_t state_ptr = levels_flat_native.get() + ((levels_flat_start[level] + node) * state_size);
+		aggr.function.initialize(state_ptr);
+		const auto pos = node * TREE_FANOUT;
+		part.WindowSegmentValue(*this, level, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
+		part.FlushStates(level > 0);
+	}
+}
+
 void WindowSegmentTree::ConstructTree() {
 	D_ASSERT(inputs.ColumnCount() > 0);
 
@@ -851,31 +941,43 @@ void WindowSegmentTree::ConstructTree() {
 		internal_nodes += level_nodes;
 	} while (level_nodes > 1);
 	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
+
+	// compute where the nodes of each level are stored
 	levels_flat_start.push_back(0);
+	for (idx_t level_size = inputs.size(); level_size > 1;) {
+		level_size = (level_size + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		levels_flat_start.push_back(levels_flat_start.back() + level_size);
+	}
 
-	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
 	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
+	// the nodes of a level only depend on the level below, so large levels are split up over multiple tasks
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	const auto threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	for (idx_t level = 0; level + 1 < levels_flat_start.size(); ++level) {
+		const auto level_nodes = levels_flat_start[level + 1] - levels_flat_start[level];
+		const auto task_count = MinValue(threads, level_nodes / PARALLEL_BUILD_NODES);
+		if (task_count <= 1) {
+			ConstructNodes(gtstate, level, 0, level_nodes);
+			continue;
 		}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+		// the other threads help out when they are idle, this thread constructs the chunks that are left
+		// and only blocks on the chunks that are still being constructed by the others
+		while (build_states.size() + 1 < task_count) {
+			build_states.emplace_back(GetLocalState());
+		}
+		auto build = make_shared_ptr<WindowSegmentTreeLevelBuild>(*this, level, level_nodes, task_count);
+		auto token = scheduler.CreateProducer();
+		for (idx_t task_idx = 0; task_idx + 1 < task_count; ++task_idx) {
+			auto &part = build_states[task_idx]->Cast<WindowSegmentTreeState>().part;
+			scheduler.ScheduleTask(*token, make_shared_ptr<WindowSegmentTreeBuildTask>(build, part));
+		}
+		build->Build(gtstate);
+		build->Wait();
 	}
 
 	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
+	if (levels_flat_start.size() == 1) {
 		aggr.function.initialize(levels_flat_native.get());
 	}
 }
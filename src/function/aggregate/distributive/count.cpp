@@ -140,29 +140,7 @@ struct CountFunction : public BaseCountFunction {
 	}
 
 	static inline void CountFlatUpdateLoop(STATE &result, ValidityMask &mask, idx_t count) {
-		idx_t base_idx = 0;
-		auto entry_count = ValidityMask::EntryCount(count);
-		for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
-			auto validity_entry = mask.GetValidityEntry(entry_idx);
-			idx_t next = MinValue<idx_t>(base_idx + ValidityMask::BITS_PER_VALUE, count);
-			if (ValidityMask::AllValid(validity_entry)) {
-				// all valid
-				result += next - base_idx;
-				base_idx = next;
-			} else if (ValidityMask::NoneValid(validity_entry)) {
-				// nothing valid: skip all
-				base_idx = next;
-				continue;
-			} else {
-				// partially valid: need to check individual elements for validity
-				idx_t start = base_idx;
-				for (; base_idx < next; base_idx++) {
-					if (ValidityMask::RowIsValid(validity_entry, base_idx - start)) {
-						result++;
-					}
-				}
-			}
-		}
+		result += mask.CountValid(count);
 	}
 
 	static inline void CountUpdateLoop(STATE &result, ValidityMask &mask, idx_t count,
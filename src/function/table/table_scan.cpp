@@ -259,6 +259,68 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Row Id Fetch
+//===--------------------------------------------------------------------===//
+struct RowIdFetchLocalState : public LocalTableFunctionState {
+	vector<column_t> column_ids;
+	ColumnFetchState fetch_state;
+	DataChunk fetch_chunk;
+};
+
+static unique_ptr<LocalTableFunctionState> RowIdFetchInitLocal(ExecutionContext &context,
+                                                               TableFunctionInitInput &input,
+                                                               GlobalTableFunctionState *gstate) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto result = make_uniq<RowIdFetchLocalState>();
+	vector<LogicalType> types;
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+		if (id == COLUMN_IDENTIFIER_ROW_ID) {
+			types.emplace_back(LogicalType::ROW_TYPE);
+		} else {
+			types.push_back(bind_data.table.GetColumn(LogicalIndex(id)).Type());
+		}
+	}
+	result->fetch_chunk.Initialize(context.client, types);
+	return std::move(result);
+}
+
+static OperatorResultType RowIdFetchFunction(ExecutionContext &context, TableFunctionInput &data_p, DataChunk &input,
+                                             DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.local_state->Cast<RowIdFetchLocalState>();
+	auto &transaction = DuckTransaction::Get(context.client, bind_data.table.catalog);
+	auto &local_storage = LocalStorage::Get(transaction);
+	auto &storage = bind_data.table.GetStorage();
+
+	// the row ids are the last column of the input
+	auto &row_ids = input.data[input.ColumnCount() - 1];
+	row_ids.Flatten(input.size());
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+	// rows are either fetched from the table or from the transaction-local storage: fetch runs of either, so that the
+	// rows are emitted in the order of the input
+	idx_t start = 0;
+	while (start < input.size()) {
+		bool is_local = row_id_data[start] >= MAX_ROW_ID;
+		idx_t end = start + 1;
+		while (end < input.size() && (row_id_data[end] >= MAX_ROW_ID) == is_local) {
+			end++;
+		}
+		Vector run_ids(LogicalType::ROW_TYPE, data_ptr_cast(row_id_data + start));
+		state.fetch_chunk.Reset();
+		if (is_local) {
+			local_storage.FetchChunk(storage, run_ids, end - start, state.column_ids, state.fetch_chunk,
+			                         state.fetch_state);
+		} else {
+			storage.Fetch(transaction, state.fetch_chunk, state.column_ids, run_ids, end - start, state.fetch_state);
+		}
+		output.Append(state.fetch_chunk);
+		start = end;
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -398,6 +460,19 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetRowIdFetchFunction() {
+	TableFunction fetch_function("row_id_fetch", {}, nullptr);
+	fetch_function.in_out_function = RowIdFetchFunction;
+	fetch_function.init_local = RowIdFetchInitLocal;
+	fetch_function.dependency = TableScanDependency;
+	fetch_function.to_string = TableScanToString;
+	fetch_function.projection_pushdown = true;
+	fetch_function.get_bind_info = TableScanGetBindInfo;
+	fetch_function.serialize = TableScanSerialize;
+	fetch_function.deserialize = TableScanDeserialize;
+	return fetch_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -413,6 +488,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.dynamic_filter_pushdown = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
@@ -424,6 +500,7 @@ void TableScanFunction::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(std::move(table_scan_set));
 
 	set.AddFunction(GetIndexScanFunction());
+	set.AddFunction(GetRowIdFetchFunction());
 }
 
 void BuiltinFunctions::RegisterTableScanFunctions() {
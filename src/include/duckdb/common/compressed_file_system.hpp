@@ -10,6 +10,12 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/error_data.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 class CompressedFile;
@@ -51,9 +57,94 @@ public:
 	DUCKDB_API bool OnDiskFile(FileHandle &handle) override;
 	DUCKDB_API bool CanSeek() override;
 
+	DUCKDB_API void SetDecompressionThreads(FileHandle &handle, idx_t threads) override;
+
 	DUCKDB_API virtual unique_ptr<StreamWrapper> CreateStream() = 0;
 	DUCKDB_API virtual idx_t InBufferSize() = 0;
 	DUCKDB_API virtual idx_t OutBufferSize() = 0;
+
+	//! Whether the compressed data consists of frames (e.g. gzip members or zstd frames) that can be decompressed
+	//! independently of each other
+	DUCKDB_API virtual bool SupportsParallelDecompression();
+	//! Returns the size of the frame that starts at "data", or 0 if the frame does not end within "size" bytes. The
+	//! end of a frame can be a guess, in which case DecompressFrames returns false if the guess was wrong.
+	DUCKDB_API virtual idx_t FindFrameEnd(const_data_ptr_t data, idx_t size);
+	//! Decompresses a sequence of frames and appends the decompressed data to "result". Returns false if the data does
+	//! not consist of complete frames.
+	DUCKDB_API virtual bool DecompressFrames(const_data_ptr_t data, idx_t size, unsafe_vector<data_t> &result);
+};
+
+//! A range of compressed frames that is decompressed by one of the threads of a ParallelDecompressor
+struct DecompressionUnit {
+	//! The offset of the compressed data in the file
+	idx_t start = 0;
+	unsafe_vector<data_t> input;
+	unsafe_vector<data_t> output;
+	//! Whether the unit has been decompressed
+	bool finished = false;
+	//! Whether the input consisted of complete frames
+	bool success = false;
+	//! The error that was thrown while decompressing (if any)
+	ErrorData error;
+};
+
+//! The ParallelDecompressor reads a compressed file sequentially, splits it into units of complete frames, and
+//! decompresses the units in parallel in background threads. The decompressed data is read in order.
+class ParallelDecompressor {
+public:
+	ParallelDecompressor(CompressedFileSystem &compressed_fs, FileHandle &child_handle, idx_t thread_count);
+	~ParallelDecompressor();
+
+	//! The compressed file is split into units of (at least) this size
+	static constexpr const idx_t UNIT_SIZE = 1ULL << 20ULL;
+	//! If the end of a frame can not be found within this many bytes, the remainder is decompressed sequentially
+	static constexpr const idx_t MAX_FRAME_SEARCH_SIZE = 1ULL << 24ULL;
+
+public:
+	//! Reads up to "nr_bytes" of decompressed data, returns less only once there are no more units to read
+	idx_t Read(data_ptr_t buffer, idx_t nr_bytes);
+	//! Whether the remainder of the file (starting at "position") has to be decompressed sequentially after all units
+	//! have been read
+	bool RequiresSequentialRead(idx_t &position) const;
+
+private:
+	//! Splits the next unit off the compressed data, returns nullptr if there is none
+	unique_ptr<DecompressionUnit> SplitUnit();
+	//! Schedules units until the maximum amount of units is in flight
+	void ScheduleUnits();
+	//! Moves to the next unit, returns false if there is none
+	bool NextUnit();
+	void WaitForUnit(DecompressionUnit &unit);
+	void Decompress(DecompressionUnit &unit);
+	void WorkerThread();
+
+private:
+	CompressedFileSystem &compressed_fs;
+	FileHandle &child_handle;
+	idx_t max_units_in_flight;
+
+	//! Compressed data that was read, but not yet assigned to a unit
+	unsafe_vector<data_t> pending;
+	//! The offset of the pending data in the file
+	idx_t pending_start = 0;
+	bool input_exhausted = false;
+	//! Whether the end of a frame could not be found (and the remainder is decompressed sequentially)
+	bool sequential_fallback = false;
+	idx_t fallback_position = 0;
+
+	//! The units in flight (in order)
+	deque<unique_ptr<DecompressionUnit>> units;
+	//! The unit that is currently being read
+	unique_ptr<DecompressionUnit> current_unit;
+	idx_t current_offset = 0;
+
+	mutex lock;
+	std::condition_variable work_available;
+	std::condition_variable work_finished;
+	//! The units that have not been picked up by a thread yet
+	deque<reference<DecompressionUnit>> work_queue;
+	bool shutdown = false;
+	vector<thread> threads;
 };
 
 class CompressedFile : public FileHandle {
@@ -66,6 +157,8 @@ public:
 	//! Whether the file is opened for reading or for writing
 	bool write = false;
 	StreamData stream_data;
+	//! The number of threads that can be used to decompress the file
+	idx_t decompression_threads = 1;
 
 public:
 	DUCKDB_API void Initialize(bool write);
@@ -75,6 +168,8 @@ public:
 
 private:
 	unique_ptr<StreamWrapper> stream_wrapper;
+	//! Set instead of the stream wrapper when the file is decompressed in parallel
+	unique_ptr<ParallelDecompressor> parallel_decompressor;
 };
 
 } // namespace duckdb
@@ -250,6 +250,10 @@ enum class RenderMode : uint8_t;
 
 enum class ResultModifierType : uint8_t;
 
+enum class SIMDComparison : uint8_t;
+
+enum class SIMDLevel : uint8_t;
+
 enum class SampleMethod : uint8_t;
 
 enum class SampleType : uint8_t;
@@ -282,6 +286,8 @@ enum class SinkNextBatchType : uint8_t;
 
 enum class SinkResultType : uint8_t;
 
+enum class SketchType : uint8_t;
+
 enum class SourceResultType : uint8_t;
 
 enum class StatementReturnType : uint8_t;
@@ -664,6 +670,12 @@ const char* EnumUtil::ToChars<RenderMode>(RenderMode value);
 template<>
 const char* EnumUtil::ToChars<ResultModifierType>(ResultModifierType value);
 
+template<>
+const char* EnumUtil::ToChars<SIMDComparison>(SIMDComparison value);
+
+template<>
+const char* EnumUtil::ToChars<SIMDLevel>(SIMDLevel value);
+
 template<>
 const char* EnumUtil::ToChars<SampleMethod>(SampleMethod value);
 
@@ -712,6 +724,9 @@ const char* EnumUtil::ToChars<SinkNextBatchType>(SinkNextBatchType value);
 template<>
 const char* EnumUtil::ToChars<SinkResultType>(SinkResultType value);
 
+template<>
+const char* EnumUtil::ToChars<SketchType>(SketchType value);
+
 template<>
 const char* EnumUtil::ToChars<SourceResultType>(SourceResultType value);
 
@@ -1121,6 +1136,12 @@ RenderMode EnumUtil::FromString<RenderMode>(const char *value);
 template<>
 ResultModifierType EnumUtil::FromString<ResultModifierType>(const char *value);
 
+template<>
+SIMDComparison EnumUtil::FromString<SIMDComparison>(const char *value);
+
+template<>
+SIMDLevel EnumUtil::FromString<SIMDLevel>(const char *value);
+
 template<>
 SampleMethod EnumUtil::FromString<SampleMethod>(const char *value);
 
@@ -1169,6 +1190,9 @@ SinkNextBatchType EnumUtil::FromString<SinkNextBatchType>(const char *value);
 template<>
 SinkResultType EnumUtil::FromString<SinkResultType>(const char *value);
 
+template<>
+SketchType EnumUtil::FromString<SketchType>(const char *value);
+
 template<>
 SourceResultType EnumUtil::FromString<SourceResultType>(const char *value);
 
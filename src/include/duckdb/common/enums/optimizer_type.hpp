@@ -29,6 +29,9 @@ enum class OptimizerType : uint32_t {
 	COMMON_AGGREGATE,
 	COLUMN_LIFETIME,
 	TOP_N,
+	LATE_MATERIALIZATION,
+	QUANTILE_SORT,
+	GROUPING_SETS,
 	COMPRESSED_MATERIALIZATION,
 	DUPLICATE_GROUPS,
 	REORDER_FILTER,
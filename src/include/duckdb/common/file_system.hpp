@@ -229,6 +229,8 @@ public:
 	DUCKDB_API virtual bool OnDiskFile(FileHandle &handle);
 
 	DUCKDB_API virtual unique_ptr<FileHandle> OpenCompressedFile(unique_ptr<FileHandle> handle, bool write);
+	//! Sets the number of threads that can be used to decompress a compressed file that is opened for reading
+	DUCKDB_API virtual void SetDecompressionThreads(FileHandle &handle, idx_t threads);
 
 	//! Create a LocalFileSystem.
 	DUCKDB_API static unique_ptr<FileSystem> CreateLocal();
@@ -34,6 +34,10 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	bool SupportsParallelDecompression() override;
+	idx_t FindFrameEnd(const_data_ptr_t data, idx_t size) override;
+	bool DecompressFrames(const_data_ptr_t data, idx_t size, unsafe_vector<data_t> &result) override;
 };
 
 static constexpr const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
@@ -0,0 +1,37 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/hardware_counters.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! A snapshot of the hardware events that were counted for a thread
+struct HardwareCounterValues {
+	idx_t cpu_cycles = 0;
+	idx_t instructions = 0;
+	//! Misses of the last level cache
+	idx_t cache_misses = 0;
+	idx_t branch_misses = 0;
+
+public:
+	//! The events that were counted between the other snapshot and this one
+	HardwareCounterValues Subtract(const HardwareCounterValues &other) const;
+};
+
+//! HardwareCounters reads the performance monitoring counters of the CPU for the calling thread. Counting is only
+//! supported on Linux (through perf_event_open), and may be disallowed by the kernel (perf_event_paranoid) or not be
+//! supported by the (virtual) machine, in which case no counters are read.
+class HardwareCounters {
+public:
+	//! Reads the counters of the calling thread, opening them on first use. Returns false if they are not available.
+	static bool Read(HardwareCounterValues &values);
+};
+
+} // namespace duckdb
@@ -0,0 +1,136 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/simd/simd_kernels.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+
+#if !defined(DUCKDB_DISABLE_SIMD_KERNELS) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+// x86 kernels are compiled with function-level target attributes, and selected at runtime based on CPUID
+#define DUCKDB_SIMD_X86
+#endif
+
+#if !defined(DUCKDB_DISABLE_SIMD_KERNELS) && defined(__aarch64__) && defined(__ARM_NEON)
+// NEON is part of the baseline of AArch64, so no runtime check is required
+#define DUCKDB_SIMD_NEON
+#endif
+
+namespace duckdb {
+
+//! The instruction set extensions the kernels can be executed with
+enum class SIMDLevel : uint8_t { SCALAR = 0, NEON = 1, AVX2 = 2, AVX512 = 3 };
+
+//! The comparisons supported by the selection kernels
+enum class SIMDComparison : uint8_t {
+	EQUAL,
+	NOT_EQUAL,
+	LESS_THAN,
+	LESS_THAN_EQUALS,
+	GREATER_THAN,
+	GREATER_THAN_EQUALS
+};
+
+//! Selects the rows for which "data[i] <comparison> constant" holds, and writes their indices to true_sel and the
+//! indices of the other rows to false_sel (either of which can be nullptr). Returns the number of selected rows.
+//! Floating point constants must not be NaN.
+template <class T>
+using simd_select_kernel_t = idx_t (*)(const T *data, T constant, SIMDComparison comparison, idx_t count,
+                                       sel_t *true_sel, sel_t *false_sel);
+
+//! SIMDKernels holds the implementations of the hot loops of the vector operations (hashing, comparisons and
+//! validity masks) for one instruction set. The kernels only deal with flat data without NULL values - the callers
+//! fall back to the generic templates for everything else.
+struct SIMDKernels {
+	//! The level these kernels are implemented with
+	SIMDLevel level;
+
+	//! result[i] = Hash(data[i])
+	void (*hash_uint64)(const uint64_t *data, hash_t *result, idx_t count);
+	void (*hash_uint32)(const uint32_t *data, hash_t *result, idx_t count);
+	//! hashes[i] = (hashes[i] * COMBINE_MULTIPLIER) ^ Hash(data[i]), i.e. VectorOperations::CombineHash
+	void (*combine_hash_uint64)(const uint64_t *data, hash_t *hashes, idx_t count);
+	void (*combine_hash_uint32)(const uint32_t *data, hash_t *hashes, idx_t count);
+
+	simd_select_kernel_t<int32_t> select_int32;
+	simd_select_kernel_t<int64_t> select_int64;
+	simd_select_kernel_t<float> select_float;
+	simd_select_kernel_t<double> select_double;
+
+	//! Returns the number of set bits in the given entries
+	idx_t (*count_bits)(const uint64_t *entries, idx_t entry_count);
+
+	//! Returns a bitmap of the MATCH_BLOCK_SIZE bytes starting at data, in which bit i is set if data[i] equals any of
+	//! the three characters (e.g. the delimiter and the newline characters of a CSV file)
+	uint64_t (*match_bytes)(const_data_ptr_t data, uint8_t c0, uint8_t c1, uint8_t c2);
+
+	//! The multiplier of MurmurHash64
+	static constexpr uint64_t HASH_MULTIPLIER = 0xd6e8feb86659fd93ULL;
+	//! The multiplier used to combine hashes
+	static constexpr uint64_t COMBINE_MULTIPLIER = 0xbf58476d1ce4e5b9ULL;
+	//! The number of bytes tested by match_bytes
+	static constexpr idx_t MATCH_BLOCK_SIZE = 64;
+
+public:
+	//! Returns the kernels of the best level supported by this CPU - these are selected once, on first use
+	DUCKDB_API static const SIMDKernels &Get();
+	//! Returns the kernels of the given level, which must be supported by this CPU
+	DUCKDB_API static SIMDKernels GetKernels(SIMDLevel level);
+	//! Returns the levels supported by this CPU, from worst to best
+	DUCKDB_API static vector<SIMDLevel> SupportedLevels();
+
+	//! Evaluates a single comparison, used for the rows that do not fill an entire register
+	template <class T>
+	static inline bool Compare(T left, T right, SIMDComparison comparison) {
+		switch (comparison) {
+		case SIMDComparison::EQUAL:
+			return Equals::Operation(left, right);
+		case SIMDComparison::NOT_EQUAL:
+			return NotEquals::Operation(left, right);
+		case SIMDComparison::LESS_THAN:
+			return LessThan::Operation(left, right);
+		case SIMDComparison::LESS_THAN_EQUALS:
+			return LessThanEquals::Operation(left, right);
+		case SIMDComparison::GREATER_THAN:
+			return GreaterThan::Operation(left, right);
+		default:
+			return GreaterThanEquals::Operation(left, right);
+		}
+	}
+
+	//! Writes the selection for rows [offset, count) using the scalar comparison
+	template <class T>
+	static inline void SelectRemaining(const T *data, T constant, SIMDComparison comparison, idx_t offset,
+	                                   idx_t count, sel_t *true_sel, idx_t &true_count, sel_t *false_sel,
+	                                   idx_t &false_count) {
+		for (idx_t i = offset; i < count; i++) {
+			const bool match = Compare<T>(data[i], constant, comparison);
+			if (true_sel) {
+				true_sel[true_count] = UnsafeNumericCast<sel_t>(i);
+			}
+			if (false_sel) {
+				false_sel[false_count] = UnsafeNumericCast<sel_t>(i);
+			}
+			true_count += match;
+			false_count += !match;
+		}
+	}
+
+private:
+	static SIMDKernels ScalarKernels();
+#ifdef DUCKDB_SIMD_X86
+	static SIMDKernels AVX2Kernels();
+	static SIMDKernels AVX512Kernels();
+#endif
+#ifdef DUCKDB_SIMD_NEON
+	static SIMDKernels NEONKernels();
+#endif
+};
+
+} // namespace duckdb
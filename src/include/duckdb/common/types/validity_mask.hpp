@@ -102,20 +102,24 @@ public:
 			return count;
 		}
 
-		idx_t valid = 0;
-		const auto entry_count = EntryCount(count);
-		for (idx_t entry_idx = 0; entry_idx < entry_count;) {
-			auto entry = GetValidityEntry(entry_idx++);
-			// Handle ragged end (if not exactly multiple of BITS_PER_VALUE)
-			if (entry_idx == entry_count && count % BITS_PER_VALUE != 0) {
-				idx_t idx_in_entry;
-				GetEntryIndex(count, entry_idx, idx_in_entry);
-				for (idx_t i = 0; i < idx_in_entry; ++i) {
-					valid += idx_t(RowIsValid(entry, i));
-				}
-				break;
+		const auto full_entries = count / BITS_PER_VALUE;
+		idx_t valid = CountBits(validity_mask, full_entries);
+		// Handle ragged end (if not exactly multiple of BITS_PER_VALUE)
+		const auto remainder = count % BITS_PER_VALUE;
+		if (remainder != 0) {
+			auto entry = GetValidityEntry(full_entries);
+			for (idx_t i = 0; i < remainder; ++i) {
+				valid += idx_t(RowIsValid(entry, i));
 			}
+		}
+		return valid;
+	}
 
+	//! Returns the number of set bits in the given entries
+	static idx_t CountBits(const V *entries, idx_t entry_count) {
+		idx_t valid = 0;
+		for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+			auto entry = entries[entry_idx];
 			// Handle all set
 			if (AllValid(entry)) {
 				valid += BITS_PER_VALUE;
@@ -128,7 +132,6 @@ public:
 				++valid;
 			}
 		}
-
 		return valid;
 	}
 
@@ -323,6 +326,10 @@ protected:
 	idx_t target_count;
 };
 
+//! Counting the bits of the validity masks of vectors uses the SIMD kernels
+template <>
+DUCKDB_API idx_t TemplatedValidityMask<validity_t>::CountBits(const validity_t *entries, idx_t entry_count);
+
 struct ValidityMask : public TemplatedValidityMask<validity_t> {
 public:
 	inline ValidityMask() : TemplatedValidityMask(nullptr) {
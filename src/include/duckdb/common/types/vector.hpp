@@ -433,6 +433,8 @@ struct StringVector {
 	DUCKDB_API static void AddBuffer(Vector &vector, buffer_ptr<VectorBuffer> buffer);
 	//! Add a reference from this vector to the string heap of the provided vector
 	DUCKDB_API static void AddHeapReference(Vector &vector, Vector &other);
+	//! Sets the auxiliary data of the string heap of the vector
+	DUCKDB_API static void SetAuxiliaryData(Vector &vector, unique_ptr<VectorAuxiliaryData> aux_data);
 };
 
 struct FSSTVector {
@@ -34,7 +34,8 @@ enum class VectorBufferType : uint8_t {
 };
 
 enum class VectorAuxiliaryDataType : uint8_t {
-	ARROW_AUXILIARY // Holds Arrow Chunks that this vector depends on
+	ARROW_AUXILIARY, // Holds Arrow Chunks that this vector depends on
+	SHREDDED_JSON    // Holds the shredded paths of a scanned JSON vector
 };
 
 struct VectorAuxiliaryData {
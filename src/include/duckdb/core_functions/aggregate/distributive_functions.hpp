@@ -147,6 +147,33 @@ struct EntropyFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct HllSketchFun {
+	static constexpr const char *Name = "hll_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Builds a HyperLogLog sketch of x, which can be stored and later merged with hll_merge or estimated with hll_estimate.";
+	static constexpr const char *Example = "hll_estimate(hll_sketch(A))";
+
+	static AggregateFunctionSet GetFunctions();
+};
+
+struct HllMergeFun {
+	static constexpr const char *Name = "hll_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges HyperLogLog sketches created by hll_sketch into a single sketch.";
+	static constexpr const char *Example = "hll_estimate(hll_merge(sketch))";
+
+	static AggregateFunction GetFunction();
+};
+
+struct HllEstimateFun {
+	static constexpr const char *Name = "hll_estimate";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Estimates the number of distinct elements in a HyperLogLog sketch.";
+	static constexpr const char *Example = "hll_estimate(hll_sketch(A))";
+
+	static ScalarFunction GetFunction();
+};
+
 struct KahanSumFun {
 	static constexpr const char *Name = "kahan_sum";
 	static constexpr const char *Parameters = "arg";
@@ -243,6 +270,51 @@ struct ListaggFun {
 	static constexpr const char *Name = "listagg";
 };
 
+struct ThetaSketchFun {
+	static constexpr const char *Name = "theta_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Builds a theta sketch of the distinct elements of x, which can be merged, unioned, intersected and estimated.";
+	static constexpr const char *Example = "theta_estimate(theta_sketch(A))";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ThetaMergeFun {
+	static constexpr const char *Name = "theta_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges theta sketches created by theta_sketch into a single sketch.";
+	static constexpr const char *Example = "theta_estimate(theta_merge(sketch))";
+
+	static AggregateFunction GetFunction();
+};
+
+struct ThetaUnionFun {
+	static constexpr const char *Name = "theta_union";
+	static constexpr const char *Parameters = "sketch1,sketch2";
+	static constexpr const char *Description = "Computes the union of two theta sketches.";
+	static constexpr const char *Example = "theta_estimate(theta_union(sketch1, sketch2))";
+
+	static ScalarFunction GetFunction();
+};
+
+struct ThetaIntersectFun {
+	static constexpr const char *Name = "theta_intersect";
+	static constexpr const char *Parameters = "sketch1,sketch2";
+	static constexpr const char *Description = "Computes the intersection of two theta sketches.";
+	static constexpr const char *Example = "theta_estimate(theta_intersect(sketch1, sketch2))";
+
+	static ScalarFunction GetFunction();
+};
+
+struct ThetaEstimateFun {
+	static constexpr const char *Name = "theta_estimate";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Estimates the number of distinct elements in a theta sketch.";
+	static constexpr const char *Example = "theta_estimate(theta_sketch(A))";
+
+	static ScalarFunction GetFunction();
+};
+
 struct SumFun {
 	static constexpr const char *Name = "sum";
 	static constexpr const char *Parameters = "arg";
@@ -24,6 +24,33 @@ struct ApproxQuantileFun {
 	static AggregateFunctionSet GetFunctions();
 };
 
+struct TdigestSketchFun {
+	static constexpr const char *Name = "tdigest_sketch";
+	static constexpr const char *Parameters = "x";
+	static constexpr const char *Description = "Builds a T-Digest sketch of x, which can be stored and later merged with tdigest_merge or queried with tdigest_quantile.";
+	static constexpr const char *Example = "tdigest_quantile(tdigest_sketch(A), 0.5)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct TdigestMergeFun {
+	static constexpr const char *Name = "tdigest_merge";
+	static constexpr const char *Parameters = "sketch";
+	static constexpr const char *Description = "Merges T-Digest sketches created by tdigest_sketch into a single sketch.";
+	static constexpr const char *Example = "tdigest_quantile(tdigest_merge(sketch), 0.5)";
+
+	static AggregateFunction GetFunction();
+};
+
+struct TdigestQuantileFun {
+	static constexpr const char *Name = "tdigest_quantile";
+	static constexpr const char *Parameters = "sketch,pos";
+	static constexpr const char *Description = "Computes the approximate quantile at pos from a T-Digest sketch.";
+	static constexpr const char *Example = "tdigest_quantile(tdigest_sketch(A), 0.5)";
+
+	static ScalarFunction GetFunction();
+};
+
 struct MadFun {
 	static constexpr const char *Name = "mad";
 	static constexpr const char *Parameters = "x";
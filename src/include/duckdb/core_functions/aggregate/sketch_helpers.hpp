@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/core_functions/aggregate/sketch_helpers.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! The kinds of sketches that are stored in a BLOB by the sketch aggregates
+enum class SketchType : uint8_t { HYPERLOGLOG = 1, TDIGEST = 2, THETA = 3 };
+
+//! A sketch BLOB starts with the kind of sketch and the version of its format, followed by the sketch itself
+struct SketchHeader {
+	static constexpr const idx_t SIZE = 2;
+	static constexpr const uint8_t VERSION = 1;
+
+	static const char *TypeName(SketchType type) {
+		switch (type) {
+		case SketchType::HYPERLOGLOG:
+			return "HyperLogLog";
+		case SketchType::TDIGEST:
+			return "t-digest";
+		case SketchType::THETA:
+			return "theta";
+		default:
+			throw InternalException("Unknown sketch type");
+		}
+	}
+
+	//! Creates a sketch BLOB of the given size (excluding the header) in the vector, returns the BLOB and a pointer
+	//! to where the sketch has to be written
+	static string_t Create(Vector &result, SketchType type, idx_t size, data_ptr_t &sketch) {
+		auto blob = StringVector::EmptyString(result, SIZE + size);
+		auto data = data_ptr_cast(blob.GetDataWriteable());
+		data[0] = static_cast<uint8_t>(type);
+		data[1] = VERSION;
+		sketch = data + SIZE;
+		return blob;
+	}
+
+	//! Verifies the header of a sketch BLOB, returns a pointer to and the size of the sketch
+	static const_data_ptr_t Read(const string_t &blob, SketchType type, idx_t &size) {
+		auto data = const_data_ptr_cast(blob.GetData());
+		if (blob.GetSize() < SIZE || data[0] != static_cast<uint8_t>(type)) {
+			throw InvalidInputException("Invalid %s sketch: the BLOB was not created by a %s sketch aggregate",
+			                            TypeName(type), TypeName(type));
+		}
+		if (data[1] != VERSION) {
+			throw InvalidInputException("Invalid %s sketch: unsupported version %d", TypeName(type), data[1]);
+		}
+		size = blob.GetSize() - SIZE;
+		return data + SIZE;
+	}
+};
+
+} // namespace duckdb
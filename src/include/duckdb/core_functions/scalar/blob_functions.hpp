@@ -66,4 +66,13 @@ struct CreateSortKeyFun {
 	static ScalarFunction GetFunction();
 };
 
+struct ZorderKeyFun {
+	static constexpr const char *Name = "zorder_key";
+	static constexpr const char *Parameters = "parameters...";
+	static constexpr const char *Description = "Constructs a binary-comparable key that interleaves the bits of the sort keys of the inputs, clustering rows ordered on the key on all inputs";
+	static constexpr const char *Example = "zorder_key(lat, lon)";
+
+	static ScalarFunction GetFunction();
+};
+
 } // namespace duckdb
@@ -124,6 +124,9 @@ public:
 
 	unique_ptr<PartitionedTupleData> &GetPartitionedData();
 	shared_ptr<ArenaAllocator> GetAggregateAllocator();
+	//! Replaces the allocator of the aggregate states with an empty one, returns the old allocator, which must be kept
+	//! alive as long as the states that were allocated with it
+	shared_ptr<ArenaAllocator> ReplaceAggregateAllocator();
 
 	//! Resize the HT to the specified size. Must be larger than the current size.
 	void Resize(idx_t size);
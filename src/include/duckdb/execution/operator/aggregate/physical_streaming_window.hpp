@@ -13,12 +13,16 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause, or ordered on
+//! the order of an input that is already sorted). Aggregates over running or sliding ROWS frames that end at the
+//! current row are maintained incrementally.
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
 
 	static bool IsStreamingFunction(unique_ptr<Expression> &expr);
+	//! Whether the function can be streamed over an input that follows the given order
+	static bool IsStreamingFunction(unique_ptr<Expression> &expr, const OutputOrderProperty &input_order);
 
 public:
 	PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
@@ -39,6 +43,8 @@ public:
 		return OrderPreservationType::FIXED_ORDER;
 	}
 
+	OutputOrderProperty GetOutputOrder(ClientContext &context) const override;
+
 	string ParamsToString() const override;
 };
 
@@ -13,6 +13,8 @@
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/simd/simd_kernels.hpp"
 
 namespace duckdb {
 
@@ -43,6 +45,43 @@ protected:
 	CSVStates &states;
 };
 
+//! Bitmap of the structural characters (e.g. delimiters and newlines) of a block of a CSV buffer, i.e. of the
+//! characters at which the state machine has to stop skipping. The bitmap is built with the SIMD kernels one block at a
+//! time, and reused while the scanner moves within the block.
+struct CSVStructuralBitmap {
+	CSVStructuralBitmap(uint8_t c0, uint8_t c1, uint8_t c2) : c0(c0), c1(c1), c2(c2) {
+	}
+
+	//! Returns the position of the first structural character at or after pos. If there is none in the blocks that end
+	//! before end, returns the start of the first block that does not fit (or pos if that is further ahead).
+	inline idx_t Skip(uint64_t (*match_bytes)(const_data_ptr_t, uint8_t, uint8_t, uint8_t), const char *buffer, idx_t pos,
+	                  idx_t end) {
+		while (true) {
+			const idx_t start = pos - pos % SIMDKernels::MATCH_BLOCK_SIZE;
+			if (start + SIMDKernels::MATCH_BLOCK_SIZE > end) {
+				return pos;
+			}
+			if (start != block_start) {
+				bitmap = match_bytes(const_data_ptr_cast(buffer + start), c0, c1, c2);
+				block_start = start;
+			}
+			auto remaining = bitmap & (~uint64_t(0) << (pos - start));
+			if (remaining) {
+				return start + CountZeros<uint64_t>::Trailing(remaining);
+			}
+			pos = start + SIMDKernels::MATCH_BLOCK_SIZE;
+		}
+	}
+
+private:
+	uint8_t c0;
+	uint8_t c1;
+	uint8_t c2;
+	//! The start of the block the bitmap was built for
+	idx_t block_start = DConstants::INVALID_INDEX;
+	uint64_t bitmap = 0;
+};
+
 //! This is the base of our CSV scanners.
 //! Scanners differ on what they are used for, and consequently have different performance benefits.
 class BaseScanner {
@@ -113,6 +152,10 @@ protected:
 	//! Shared pointer to the buffer_manager, this is shared across multiple scanners
 	shared_ptr<CSVBufferManager> buffer_manager;
 
+	//! The SIMD kernel used to find the structural characters, nullptr if the CPU has no SIMD support: then the
+	//! scanner skips 8 bytes at a time instead
+	uint64_t (*match_bytes)(const_data_ptr_t data, uint8_t c0, uint8_t c1, uint8_t c2) = nullptr;
+
 	//! If this scanner has been initialized
 	bool initialized = false;
 	//! How many lines were read by this scanner
@@ -139,6 +182,14 @@ protected:
 		} else {
 			to_pos = cur_buffer_handle->actual_size;
 		}
+		// the buffer does not change while processing, so the bitmaps stay valid
+		auto &transitions = state_machine->transition_array;
+		CSVStructuralBitmap standard_bitmap(static_cast<uint8_t>(transitions.delimiter),
+		                                    static_cast<uint8_t>(transitions.new_line),
+		                                    static_cast<uint8_t>(transitions.carriage_return));
+		CSVStructuralBitmap quoted_bitmap(static_cast<uint8_t>(transitions.quote),
+		                                  static_cast<uint8_t>(transitions.escape),
+		                                  static_cast<uint8_t>(transitions.quote));
 		while (iterator.pos.buffer_pos < to_pos) {
 			state_machine->Transition(states, buffer_handle_ptr[iterator.pos.buffer_pos]);
 			switch (states.states[1]) {
@@ -198,7 +249,11 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
+				if (match_bytes && iterator.pos.buffer_pos + SIMDKernels::MATCH_BLOCK_SIZE < to_pos) {
+					iterator.pos.buffer_pos = MinValue<idx_t>(
+					    quoted_bitmap.Skip(match_bytes, buffer_handle_ptr, iterator.pos.buffer_pos, to_pos), to_pos - 1);
+				}
+				while (!match_bytes && iterator.pos.buffer_pos + 8 < to_pos) {
 					uint64_t value =
 					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
 					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
@@ -220,7 +275,11 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
+				if (match_bytes && iterator.pos.buffer_pos + SIMDKernels::MATCH_BLOCK_SIZE < to_pos) {
+					iterator.pos.buffer_pos = MinValue<idx_t>(
+					    standard_bitmap.Skip(match_bytes, buffer_handle_ptr, iterator.pos.buffer_pos, to_pos), to_pos - 1);
+				}
+				while (!match_bytes && iterator.pos.buffer_pos + 8 < to_pos) {
 					uint64_t value =
 					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
 					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
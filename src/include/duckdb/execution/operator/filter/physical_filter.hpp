@@ -34,6 +34,7 @@ public:
 	}
 
 	string ParamsToString() const override;
+	OutputOrderProperty GetOutputOrder(ClientContext &context) const override;
 
 protected:
 	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
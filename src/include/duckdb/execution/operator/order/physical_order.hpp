@@ -53,6 +53,7 @@ public:
 	OrderPreservationType SourceOrder() const override {
 		return OrderPreservationType::FIXED_ORDER;
 	}
+	OutputOrderProperty GetOutputOrder(ClientContext &context) const override;
 
 public:
 	// Sink interface
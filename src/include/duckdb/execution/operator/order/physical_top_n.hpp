@@ -10,8 +10,10 @@
 
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 
 namespace duckdb {
+class TopNHeap;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -26,6 +28,8 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter that is pushed into the scan (if any), which is set to the boundary value of the heap
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
@@ -55,6 +59,9 @@ public:
 	}
 
 	string ParamsToString() const override;
+
+private:
+	void UpdateDynamicFilter(GlobalSinkState &gstate, TopNHeap &heap) const;
 };
 
 } // namespace duckdb
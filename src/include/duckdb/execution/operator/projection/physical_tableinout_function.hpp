@@ -31,6 +31,8 @@ public:
 	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
 	                                        OperatorState &state) const override;
 
+	string ParamsToString() const override;
+
 	bool ParallelOperator() const override {
 		return true;
 	}
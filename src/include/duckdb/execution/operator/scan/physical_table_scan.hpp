@@ -44,6 +44,8 @@ public:
 	unique_ptr<TableFilterSet> table_filters;
 	//! Currently stores any filters applied to file names (as strings)
 	ExtraOperatorInfo extra_info;
+	//! Whether the scan replaces a sort on its output, so that its order has to be preserved
+	bool fixed_order = false;
 
 public:
 	string GetName() const override;
@@ -69,6 +71,10 @@ public:
 	bool SupportsBatchIndex() const override {
 		return function.get_batch_index != nullptr;
 	}
+	OrderPreservationType SourceOrder() const override {
+		return fixed_order ? OrderPreservationType::FIXED_ORDER : OrderPreservationType::INSERTION_ORDER;
+	}
+	OutputOrderProperty GetOutputOrder(ClientContext &context) const override;
 
 	double GetProgress(ClientContext &context, GlobalSourceState &gstate) const override;
 };
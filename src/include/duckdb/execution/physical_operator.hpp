@@ -18,6 +18,7 @@
 #include "duckdb/common/optional_idx.hpp"
 #include "duckdb/execution/physical_operator_states.hpp"
 #include "duckdb/common/enums/order_preservation_type.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 
 namespace duckdb {
 class Event;
@@ -26,6 +27,31 @@ class PhysicalOperator;
 class Pipeline;
 class PipelineBuildState;
 class MetaPipeline;
+struct BoundOrderByNode;
+
+//! A sort key of the rows produced by a physical operator
+struct OutputOrderKey {
+	OutputOrderKey(idx_t column_index, OrderType type, OrderByNullType null_order)
+	    : column_index(column_index), type(type), null_order(null_order) {
+	}
+
+	//! The output column the rows are sorted on
+	idx_t column_index;
+	OrderType type;
+	OrderByNullType null_order;
+};
+
+//! The order the rows produced by a physical operator are known to follow
+struct OutputOrderProperty {
+	//! The sort keys, most significant first
+	vector<OutputOrderKey> keys;
+	//! Whether the order holds across the entire output (in batch index order), or only within each chunk
+	bool global = false;
+
+public:
+	//! Whether the rows are globally sorted on the given orders (over the output columns)
+	bool Satisfies(const vector<BoundOrderByNode> &orders) const;
+};
 
 //! PhysicalOperator is the base class of the physical operators present in the
 //! execution plan
@@ -99,6 +125,11 @@ public:
 		return OrderPreservationType::INSERTION_ORDER;
 	}
 
+	//! The sort order the rows produced by this operator are known to follow (if any)
+	virtual OutputOrderProperty GetOutputOrder(ClientContext &context) const {
+		return OutputOrderProperty();
+	}
+
 public:
 	// Source interface
 	virtual unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
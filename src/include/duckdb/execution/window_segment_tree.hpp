@@ -152,11 +152,13 @@ public:
 	unique_ptr<WindowAggregatorState> gstate;
 };
 
+class WindowSegmentTreePart;
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
 	WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
-	                  const WindowExcludeMode exclude_mode_p, idx_t count);
+	                  const WindowExcludeMode exclude_mode_p, idx_t count, ClientContext &context);
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
@@ -167,12 +169,16 @@ public:
 
 public:
 	void ConstructTree();
+	//! Constructs the nodes [begin, end) of a level of the tree
+	void ConstructNodes(WindowSegmentTreePart &part, idx_t level, idx_t begin, idx_t end);
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
 		return mode < WindowAggregationMode::SEPARATE;
 	}
 
+	ClientContext &context;
+
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	unsafe_unique_array<data_t> levels_flat_native;
 	//! For each level, the starting location in the levels_flat_native array
@@ -184,8 +190,13 @@ public:
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 
+	//! The states of the tasks that constructed the tree (they own the memory allocated by the aggregates)
+	vector<unique_ptr<WindowAggregatorState>> build_states;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! The minimum number of nodes of a level for constructing it in parallel
+	static constexpr idx_t PARALLEL_BUILD_NODES = 4096;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
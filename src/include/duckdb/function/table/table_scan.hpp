@@ -42,6 +42,9 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	//! An in-out function that fetches the columns of the rows whose row ids are the last column of its input (used for
+	//! late materialization)
+	static TableFunction GetRowIdFetchFunction();
 };
 
 } // namespace duckdb
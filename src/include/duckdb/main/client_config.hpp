@@ -32,12 +32,17 @@ struct ClientConfig {
 	bool enable_profiler = false;
 	//! If detailed query profiling is enabled
 	bool enable_detailed_profiling = false;
+	//! If the hardware performance counters are read for every operator while profiling (Linux only)
+	bool enable_hardware_counters = false;
 	//! The format to print query profiling information in (default: query_tree), if enabled.
 	ProfilerPrintFormat profiler_print_format = ProfilerPrintFormat::QUERY_TREE;
 	//! The file to save query profiling information to, instead of printing it to the console
 	//! (empty = print to console)
 	string profiler_save_location;
 
+	//! The file to write a trace of the threads executing every query to (empty = tracing is disabled)
+	string trace_output;
+
 	//! Allows suppressing profiler output, even if enabled. We turn on the profiler on all test runs but don't want
 	//! to output anything
 	bool emit_profiler_output = true;
@@ -89,6 +94,8 @@ struct ClientConfig {
 	idx_t perfect_ht_threshold = 12;
 	//! The maximum number of rows to accumulate before sorting ordered aggregates.
 	idx_t ordered_aggregate_threshold = (idx_t(1) << 18);
+	//! The estimated number of input rows from which exact quantiles are computed by sorting the input
+	idx_t quantile_sort_threshold = (idx_t(1) << 26);
 	//! The number of rows to accumulate before flushing during a partitioned write
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 
@@ -24,6 +24,7 @@ class FileOpener;
 class FileSystem;
 class HTTPState;
 class QueryProfiler;
+class QueryTracer;
 class PreparedStatementData;
 class SchemaCatalogEntry;
 class HTTPLogger;
@@ -35,6 +36,8 @@ struct ClientData {
 
 	//! Query profiler
 	shared_ptr<QueryProfiler> profiler;
+	//! Query tracer
+	unique_ptr<QueryTracer> tracer;
 
 	//! HTTP logger
 	shared_ptr<HTTPLogger> http_logger;
@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/operator_metrics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+
+namespace duckdb {
+
+//! The metrics that are collected for an operator by the profiler, besides its timing and cardinality
+struct OperatorMetrics {
+	//! The number of bytes read from files (including the database file) and over the network
+	idx_t bytes_read = 0;
+	//! The number of rows that were skipped without being scanned, because of zonemaps
+	idx_t rows_pruned = 0;
+	//! The number of entries in the hash tables of the operator
+	idx_t hash_table_entries = 0;
+	//! The number of slots in the hash tables of the operator
+	idx_t hash_table_capacity = 0;
+	//! The number of bytes written to temporary files to free up memory
+	idx_t bytes_spilled = 0;
+	//! The number of bytes read back from temporary files
+	idx_t bytes_reloaded = 0;
+	//! The largest memory reservation of the operator
+	idx_t peak_memory = 0;
+	//! The hardware events counted while executing the operator (if enable_hardware_counters is set)
+	idx_t cpu_cycles = 0;
+	idx_t instructions = 0;
+	idx_t cache_misses = 0;
+	idx_t branch_misses = 0;
+
+public:
+	void Combine(const OperatorMetrics &other) {
+		bytes_read += other.bytes_read;
+		rows_pruned += other.rows_pruned;
+		hash_table_entries += other.hash_table_entries;
+		hash_table_capacity += other.hash_table_capacity;
+		bytes_spilled += other.bytes_spilled;
+		bytes_reloaded += other.bytes_reloaded;
+		peak_memory = MaxValue(peak_memory, other.peak_memory);
+		cpu_cycles += other.cpu_cycles;
+		instructions += other.instructions;
+		cache_misses += other.cache_misses;
+		branch_misses += other.branch_misses;
+	}
+
+	//! The metrics that the calling thread collects for the operator that it is executing, or nullptr if the thread
+	//! is not executing a profiled operator
+	DUCKDB_API static optional_ptr<OperatorMetrics> Active();
+	//! Starts collecting metrics in the calling thread
+	static void StartCollecting();
+	//! Stops collecting metrics in the calling thread, and returns the collected metrics
+	static OperatorMetrics StopCollecting();
+};
+
+} // namespace duckdb
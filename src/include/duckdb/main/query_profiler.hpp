@@ -10,6 +10,7 @@
 
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
+#include "duckdb/common/hardware_counters.hpp"
 #include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
@@ -18,7 +19,9 @@
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/execution/expression_executor_state.hpp"
 #include "duckdb/common/reference_map.hpp"
+#include "duckdb/main/operator_metrics.hpp"
 #include <stack>
+#include <thread>
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/deque.hpp"
 
@@ -35,6 +38,7 @@ struct OperatorInformation {
 	double time = 0;
 	idx_t elements = 0;
 	string name;
+	OperatorMetrics metrics;
 };
 
 //! The OperatorProfiler measures timings of individual operators
@@ -42,27 +46,37 @@ class OperatorProfiler {
 	friend class QueryProfiler;
 
 public:
-	DUCKDB_API explicit OperatorProfiler(bool enabled);
+	DUCKDB_API explicit OperatorProfiler(bool enabled, bool hardware_counters = false);
 
 	DUCKDB_API void StartOperator(optional_ptr<const PhysicalOperator> phys_op);
 	DUCKDB_API void EndOperator(optional_ptr<DataChunk> chunk);
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor, const string &name,
 	                      int id);
+	//! Adds metrics of an operator that were collected outside of its profiled execution (e.g. in Combine)
+	DUCKDB_API void AddMetrics(const PhysicalOperator &phys_op, const OperatorMetrics &metrics);
 
 	~OperatorProfiler() {
 	}
 
 private:
-	void AddTiming(const PhysicalOperator &op, double time, idx_t elements);
+	void AddTiming(const PhysicalOperator &op, double time, idx_t elements, const OperatorMetrics &metrics);
 
 	//! Whether or not the profiler is enabled
 	bool enabled;
+	//! Whether or not the hardware counters are read around every operator
+	bool hardware_counters;
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
+	//! The hardware counters when the active operator was started
+	HardwareCounterValues counters_start;
+	//! Whether the hardware counters could be read when the active operator was started
+	bool counters_started = false;
 	//! The stack of Physical Operators that are currently active
 	optional_ptr<const PhysicalOperator> active_operator;
 	//! A mapping of physical operators to recorded timings
 	reference_map_t<const PhysicalOperator, OperatorInformation> timings;
+	//! The time spent executing operators since the last flush
+	double busy_time = 0;
 };
 
 //! The QueryProfiler can be used to measure timings of queries
@@ -105,6 +119,8 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Adds metrics of an operator that were collected outside of a thread (e.g. in Finalize)
+	DUCKDB_API void AddMetrics(const PhysicalOperator &phys_op, const OperatorMetrics &metrics);
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -149,6 +165,8 @@ private:
 	TreeMap tree_map;
 	//! Whether or not we are running as part of a explain_analyze query
 	bool is_explain_analyze;
+	//! The time each thread spent executing operators of the query, in the order in which the threads were seen
+	vector<pair<std::thread::id, double>> thread_busy_times;
 
 public:
 	const TreeMap &GetTreeMap() const {
@@ -167,6 +185,7 @@ private:
 
 private:
 	vector<PhaseTimingItem> GetOrderedPhaseTimings() const;
+	void RenderThreadTimings(std::ostream &ss) const;
 
 	//! Check whether or not an operator type requires query profiling. If none of the ops in a query require profiling
 	//! no profiling information is output.
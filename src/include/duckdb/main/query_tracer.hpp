@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_tracer.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <thread>
+
+namespace duckdb {
+class ClientContext;
+
+//! An event recorded by a thread while executing a query
+struct TraceEvent {
+	//! The category and name of the event, these must be string literals
+	const char *category = nullptr;
+	const char *name = nullptr;
+	//! The start and end of the event, in nanoseconds of the steady clock
+	int64_t start = 0;
+	int64_t end = 0;
+	//! Whether the event happened at a single point in time (start), rather than during an interval
+	bool instant = false;
+	//! Additional information about the event (if any)
+	string detail;
+};
+
+//! The events recorded by a single thread. The buffer is only written by its thread, and is a ring buffer that
+//! overwrites the oldest events once it is full.
+class TraceBuffer {
+public:
+	static constexpr const idx_t CAPACITY = 16384;
+
+	explicit TraceBuffer(idx_t thread_idx);
+
+	void Append(TraceEvent event);
+
+public:
+	//! The index of the thread in the trace
+	const idx_t thread_idx;
+	//! The events, event i is stored at position i % CAPACITY
+	vector<TraceEvent> events;
+	//! The total number of events that were appended
+	idx_t event_count = 0;
+};
+
+//! The QueryTracer records a timeline of what every thread does while a query is executed: the tasks it runs, the
+//! time it waits for tasks, the events that are scheduled and finished, and the blocks that are loaded, spilled and
+//! reloaded by the buffer manager. Tracing is enabled by setting trace_output, the trace of every query is then
+//! written to that file in the Chrome trace event format (which can be opened in Perfetto or chrome://tracing).
+class QueryTracer {
+public:
+	explicit QueryTracer(ClientContext &context);
+
+	DUCKDB_API static QueryTracer &Get(ClientContext &context);
+
+public:
+	//! Starts tracing a query, if trace_output is set
+	void StartQuery(const string &query);
+	//! Stops tracing and writes the trace to trace_output. This must only be called once no thread executes tasks of
+	//! the query anymore.
+	void EndQuery();
+	bool IsEnabled() const {
+		return enabled;
+	}
+	//! Renders the events recorded for the query in the Chrome trace event format
+	string ToJSON() const;
+
+	//! The current time of the steady clock in nanoseconds
+	static int64_t Now();
+	//! Whether the calling thread records events
+	DUCKDB_API static bool IsActive();
+	//! Records an event of the calling thread that started at start and ends now (if the thread records events)
+	DUCKDB_API static void AddEvent(const char *category, const char *name, int64_t start, string detail = string());
+	//! Records an instant event of the calling thread (if the thread records events)
+	DUCKDB_API static void AddInstantEvent(const char *category, const char *name, string detail = string());
+	//! Marks that the calling thread starts waiting for a task. The wait is recorded when the thread next starts a
+	//! task of a traced query.
+	static void StartWaiting();
+
+private:
+	friend class QueryTracerScope;
+
+	//! Returns the buffer of the calling thread, creating it if it does not exist yet
+	TraceBuffer &GetThreadBuffer();
+
+private:
+	ClientContext &context;
+	//! Whether a query is being traced
+	bool enabled = false;
+	//! Incremented for every traced query, so threads know when their cached buffer became stale
+	idx_t query_id = 0;
+	//! The query that is being traced, and the time at which it started
+	string query;
+	int64_t query_start = 0;
+	//! The buffers of the threads that recorded events for the query
+	mutex lock;
+	unordered_map<std::thread::id, unique_ptr<TraceBuffer>> buffers;
+};
+
+//! While a QueryTracerScope is alive, the calling thread records its events in the tracer of the query (if the
+//! query is traced)
+class QueryTracerScope {
+public:
+	explicit QueryTracerScope(ClientContext &context);
+	~QueryTracerScope();
+
+private:
+	bool active = false;
+	optional_ptr<TraceBuffer> previous_buffer;
+	int64_t previous_query_start = 0;
+};
+
+//! A TraceSpan records an event that lasts from its construction until its destruction
+class TraceSpan {
+public:
+	TraceSpan(const char *category, const char *name)
+	    : category(category), name(name), start(QueryTracer::IsActive() ? QueryTracer::Now() : -1) {
+	}
+	~TraceSpan() {
+		if (start >= 0) {
+			QueryTracer::AddEvent(category, name, start, std::move(detail));
+		}
+	}
+
+	//! Additional information about the event (if any)
+	string detail;
+
+private:
+	const char *category;
+	const char *name;
+	int64_t start;
+};
+
+} // namespace duckdb
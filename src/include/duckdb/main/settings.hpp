@@ -112,6 +112,16 @@ struct OrderedAggregateThreshold {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct QuantileSortThreshold {
+	static constexpr const char *Name = "quantile_sort_threshold"; // NOLINT
+	static constexpr const char *Description =                     // NOLINT
+	    "The estimated number of input rows from which exact quantiles are computed by sorting the input";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugAsOfIEJoin {
 	static constexpr const char *Name = "debug_asof_iejoin";                                                 // NOLINT
 	static constexpr const char *Description = "DEBUG SETTING: force use of IEJoin to implement AsOf joins"; // NOLINT
@@ -338,6 +348,16 @@ struct EnableHTTPMetadataCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableHardwareCountersSetting {
+	static constexpr const char *Name = "enable_hardware_counters";
+	static constexpr const char *Description =
+	    "Count CPU cycles, instructions, cache misses and branch misses per operator when profiling (Linux only)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableProfilingSetting {
 	static constexpr const char *Name = "enable_profiling";
 	static constexpr const char *Description =
@@ -663,6 +683,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TraceOutputSetting {
+	static constexpr const char *Name = "trace_output";
+	static constexpr const char *Description =
+	    "The file to write a timeline of the threads executing each query to, in the Chrome trace event format";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
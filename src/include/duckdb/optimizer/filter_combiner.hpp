@@ -48,6 +48,9 @@ public:
 	void GenerateFilters(const std::function<void(unique_ptr<Expression> filter)> &callback);
 	bool HasFilters();
 	TableFilterSet GenerateTableScanFilters(vector<idx_t> &column_ids);
+	//! Generates pruning-only filters for comparisons on paths of JSON columns (e.g. j->>'$.a' = 'x'). The filters
+	//! are kept in the combiner, as the pushed filters do not filter rows.
+	void GenerateJSONPathFilters(vector<idx_t> &column_ids, TableFilterSet &table_filters);
 	// vector<unique_ptr<TableFilter>> GenerateZonemapChecks(vector<idx_t> &column_ids, vector<unique_ptr<TableFilter>>
 	// &pushed_filters);
 
@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/grouping_sets_rewriter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+
+namespace duckdb {
+class BoundAggregateExpression;
+class Expression;
+class LogicalAggregate;
+class LogicalOperator;
+class Optimizer;
+
+//! The GroupingSetsRewriter evaluates GROUPING SETS, ROLLUP and CUBE over decomposable aggregates (count, sum, min,
+//! max and avg) by first aggregating the input on all groups, and then computing every grouping set from that
+//! (much smaller) intermediate result, instead of aggregating the full input once per grouping set.
+class GroupingSetsRewriter {
+public:
+	explicit GroupingSetsRewriter(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	unique_ptr<LogicalOperator> OptimizeInternal(unique_ptr<LogicalOperator> op);
+	unique_ptr<LogicalOperator> TryRewrite(unique_ptr<LogicalOperator> op);
+	//! Whether the aggregate can be computed from partial aggregates over the finest grouping set
+	static bool CanPreAggregate(BoundAggregateExpression &aggr);
+
+	unique_ptr<Expression> BindScalarFunction(const string &name, vector<unique_ptr<Expression>> children);
+	unique_ptr<Expression> BindAggregateFunction(const string &name, vector<unique_ptr<Expression>> children,
+	                                             unique_ptr<Expression> filter);
+
+private:
+	Optimizer &optimizer;
+	//! Maps the bindings of the rewritten aggregates to the projections that replace them
+	ColumnBindingReplacer replacer;
+};
+
+} // namespace duckdb
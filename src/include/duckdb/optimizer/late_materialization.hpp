@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/late_materialization.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+class LogicalOperator;
+class Optimizer;
+
+//! The LateMaterialization optimizer defers reading the columns that are only projected by a Top-N over a base table
+//! scan: the Top-N is computed over the ordering and filter columns (and the row ids) only, after which the remaining
+//! columns are fetched for the (few) qualifying rows by row id
+class LateMaterialization {
+public:
+	explicit LateMaterialization(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+	//! The maximum amount of rows a Top-N can emit for the remaining columns to be fetched by row id
+	static constexpr const idx_t MAX_ROW_COUNT = 10000;
+
+private:
+	bool TryLateMaterialization(unique_ptr<LogicalOperator> &op);
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
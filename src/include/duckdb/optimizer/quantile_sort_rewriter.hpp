@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/quantile_sort_rewriter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+class BoundAggregateExpression;
+class Expression;
+class LogicalAggregate;
+class LogicalOperator;
+class Optimizer;
+
+//! The QuantileSortRewriter computes exact quantiles over large inputs by sorting the input in parallel instead of
+//! accumulating every value of a group in the hash table. The input is partitioned on the groups and sorted on the
+//! argument of the quantile by a window operator, which also numbers the rows and counts the values of each group.
+//! The aggregate then only has to pick (and interpolate between) the rows at the positions of the quantile.
+class QuantileSortRewriter {
+public:
+	explicit QuantileSortRewriter(Optimizer &optimizer);
+
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	bool TryRewrite(LogicalAggregate &aggr);
+	//! Whether the aggregate is an exact quantile that can be computed from the sorted input
+	bool CanRewrite(BoundAggregateExpression &aggr, bool &discrete);
+
+	unique_ptr<Expression> BindScalarFunction(const string &name, vector<unique_ptr<Expression>> children);
+	unique_ptr<Expression> BindAggregateFunction(const string &name, vector<unique_ptr<Expression>> children,
+	                                             unique_ptr<Expression> filter);
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
@@ -15,6 +15,7 @@
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/catalog/catalog_entry/column_dependency_manager.hpp"
 #include "duckdb/parser/column_list.hpp"
+#include "duckdb/parser/result_modifier.hpp"
 
 namespace duckdb {
 class SchemaCatalogEntry;
@@ -32,6 +33,14 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The maximum number of rows per row group (if not set, the default row group size is used)
+	optional_idx row_group_size;
+	//! The columns the data of the table is sorted on when it is checkpointed (if any)
+	vector<OrderByNode> order_by;
+	//! The order_by table option as it was specified, it is parsed into order_by when the table is bound
+	string order_by_option;
+	//! The cluster_by table option of CREATE TABLE AS, the query is clustered on it when the table is bound
+	string cluster_by_option;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
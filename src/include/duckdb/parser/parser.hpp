@@ -56,6 +56,9 @@ public:
 	static GroupByNode ParseGroupByList(const string &group_by, ParserOptions options = ParserOptions());
 	//! Parses a list as found in an ORDER BY expression (i.e. including optional ASCENDING/DESCENDING modifiers)
 	static vector<OrderByNode> ParseOrderList(const string &select_list, ParserOptions options = ParserOptions());
+	//! Parses a list of expressions to cluster on, and orders the result of the query on a Z-order curve over them
+	static unique_ptr<QueryNode> ParseClusterBy(const string &cluster_list, unique_ptr<QueryNode> node,
+	                                            ParserOptions options = ParserOptions());
 	//! Parses an update list (i.e. the list found in the SET clause of an UPDATE statement)
 	static void ParseUpdateList(const string &update_list, vector<string> &update_columns,
 	                            vector<unique_ptr<ParsedExpression>> &expressions,
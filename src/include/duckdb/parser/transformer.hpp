@@ -32,6 +32,7 @@ namespace duckdb {
 class ColumnDefinition;
 struct OrderByNode;
 struct CopyInfo;
+struct CreateTableInfo;
 struct CommonTableExpressionInfo;
 struct GroupingExpressionMap;
 class OnConflictInfo;
@@ -64,6 +65,10 @@ public:
 
 	idx_t ParamCount() const;
 
+	//! Order the result of a query on a Z-order curve over the given expressions, clustering it on all of them
+	static unique_ptr<QueryNode> TransformClusterBy(unique_ptr<QueryNode> node,
+	                                                vector<unique_ptr<ParsedExpression>> cluster_by);
+
 private:
 	optional_ptr<Transformer> parent;
 	//! Parser options
@@ -282,6 +287,8 @@ private:
 	string TransformCollation(optional_ptr<duckdb_libpgquery::PGCollateClause> collate);
 
 	ColumnDefinition TransformColumnDefinition(duckdb_libpgquery::PGColumnDef &cdef);
+	//! Transform the WITH (...) storage options of a CREATE TABLE statement
+	void TransformTableOptions(CreateTableInfo &info, optional_ptr<duckdb_libpgquery::PGList> table_options);
 	//===--------------------------------------------------------------------===//
 	// Helpers
 	//===--------------------------------------------------------------------===//
@@ -71,6 +71,10 @@ public:
 	idx_t GetSharedOrders(const BoundWindowExpression &other) const;
 
 	bool PartitionsAreEquivalent(const BoundWindowExpression &other) const;
+	//! Whether the rows sorted for the other window are also partitioned and sorted for this window, i.e., whether
+	//! the partitions of this window are the partitions of the other window followed by a prefix of its orders,
+	//! and the orders of this window are the orders of the other window that follow
+	bool SortIsPrefixOf(const BoundWindowExpression &other) const;
 	bool KeysAreCompatible(const BoundWindowExpression &other) const;
 	bool Equals(const BaseExpression &other) const override;
 
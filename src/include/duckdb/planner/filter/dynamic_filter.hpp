@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! The shared state of a dynamic filter: the filter is set (and tightened) by an operator during execution, while it
+//! is concurrently being used by the scans
+struct DynamicFilterData {
+	DynamicFilterData(ExpressionType comparison_type, const LogicalType &type);
+
+	mutex lock;
+	//! The constant comparison, only valid once the filter is initialized
+	unique_ptr<ConstantFilter> filter;
+	//! Whether or not a value has been set
+	bool initialized = false;
+
+public:
+	//! Sets the constant of the comparison
+	void SetValue(Value val);
+	//! Clears the filter, i.e. before a new execution of the plan
+	void Reset();
+};
+
+//! A comparison with a constant that is only known during execution, e.g. the current boundary of a Top-N heap. Until
+//! a value is set, the filter does not filter anything
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter data, or nullptr if this filter was deserialized (and is never set)
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -0,0 +1,39 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/json_path_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+
+//! A filter on a path within a JSON column, i.e. json_extract_string(col, path) > C. The filter is only used to prune
+//! row groups using the statistics of the shredded sub-column of the path: it never filters any rows itself, the
+//! filter expression is still evaluated on top of the scan
+class JSONPathFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::JSON_PATH;
+
+public:
+	JSONPathFilter(string path, unique_ptr<TableFilter> child_filter);
+
+	//! The (normalized) JSON path to filter on
+	string path;
+
+	//! The child filter, that is applied to the values of the path
+	unique_ptr<TableFilter> child_filter;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/logical_operator.hpp"
 
 namespace duckdb {
@@ -28,6 +29,8 @@ public:
 	idx_t limit;
 	//! The offset from the start to begin emitting elements
 	idx_t offset;
+	//! The filter on the first order column that is pushed into the scan, if any: it is set to the boundary of the heap
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	vector<ColumnBinding> GetColumnBindings() override {
@@ -22,7 +22,9 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	JSON_PATH = 6, // pruning-only filter on a path within a JSON column
+	DYNAMIC_FILTER = 7 // constant comparison whose constant is set during execution
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
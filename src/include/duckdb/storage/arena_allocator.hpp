@@ -10,6 +10,7 @@
 
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 
@@ -26,6 +27,8 @@ struct ArenaChunk {
 
 class ArenaAllocator {
 	static constexpr const idx_t ARENA_ALLOCATOR_INITIAL_CAPACITY = 2048;
+	//! The capacity of the chunks doubles up to this size, so a large arena does not need a single huge allocation
+	static constexpr const idx_t ARENA_ALLOCATOR_MAX_CAPACITY = 1ULL << 24ULL;
 
 public:
 	DUCKDB_API explicit ArenaAllocator(Allocator &allocator, idx_t initial_capacity = ARENA_ALLOCATOR_INITIAL_CAPACITY);
@@ -71,4 +74,50 @@ private:
 	idx_t allocated_size = 0;
 };
 
+//! An STL allocator that allocates from an ArenaAllocator, e.g. the allocator that the aggregate states of a hash table
+//! are allocated in. Deallocation is a no-op: the memory is released when the arena is destroyed. Without an arena,
+//! the standard allocator is used
+template <class T>
+class ArenaStlAllocator {
+public:
+	using value_type = T;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	ArenaStlAllocator() noexcept : arena(nullptr) {
+	}
+	explicit ArenaStlAllocator(ArenaAllocator &arena_p) noexcept : arena(&arena_p) {
+	}
+	template <class U>
+	ArenaStlAllocator(const ArenaStlAllocator<U> &other) noexcept : arena(other.arena) { // NOLINT: allow conversion
+	}
+
+	//! The arena to allocate from, or nullptr to use the standard allocator
+	optional_ptr<ArenaAllocator> arena;
+
+public:
+	T *allocate(std::size_t n) {
+		if (!arena) {
+			return std::allocator<T>().allocate(n);
+		}
+		return reinterpret_cast<T *>(arena->AllocateAligned(n * sizeof(T)));
+	}
+
+	void deallocate(T *pointer, std::size_t n) noexcept {
+		if (!arena) {
+			std::allocator<T>().deallocate(pointer, n);
+		}
+	}
+
+	template <class U>
+	bool operator==(const ArenaStlAllocator<U> &other) const noexcept {
+		return arena.get() == other.arena.get();
+	}
+	template <class U>
+	bool operator!=(const ArenaStlAllocator<U> &other) const noexcept {
+		return arena.get() != other.arena.get();
+	}
+};
+
 } // namespace duckdb
@@ -63,6 +63,8 @@ struct RowGroupPointer {
 	vector<MetaBlockPointer> data_pointers;
 	//! Data pointers to the delete information of the row group (if any)
 	vector<MetaBlockPointer> deletes_pointers;
+	//! Whether or not the rows of the row group are sorted on the sort keys of the table
+	bool sorted = false;
 };
 
 } // namespace duckdb
@@ -52,7 +52,7 @@ public:
 	//! Constructs a new data table from an (optional) set of persistent segments
 	DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager, const string &schema,
 	          const string &table, vector<ColumnDefinition> column_definitions_p,
-	          unique_ptr<PersistentTableData> data = nullptr);
+	          unique_ptr<PersistentTableData> data = nullptr, idx_t row_group_size = Storage::ROW_GROUP_SIZE);
 	//! Constructs a DataTable as a delta on an existing data table with a newly added column
 	DataTable(ClientContext &context, DataTable &parent, ColumnDefinition &new_column, Expression &default_value);
 	//! Constructs a DataTable as a delta on an existing data table but with one column removed
@@ -71,6 +71,13 @@ public:
 	TableIOManager &GetTableIOManager();
 
 	bool IsTemporary() const;
+	//! Returns the maximum number of rows per row group of the table
+	idx_t GetRowGroupSize() const;
+	//! Returns the keys the rows of the table are sorted on when it is checkpointed (if any)
+	const vector<TableSortKey> &GetSortKeys() const;
+	void SetSortKeys(vector<TableSortKey> sort_keys);
+	//! Returns how many of the leading sort keys hold across the entire table (rather than per row group)
+	idx_t GetGloballySortedKeyCount();
 
 	//! Returns a list of types of the table
 	vector<LogicalType> GetTypes();
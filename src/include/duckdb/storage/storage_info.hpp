@@ -40,10 +40,13 @@ struct Storage {
 	//! The size of the headers. This should be small and written more or less atomically by the hard disk. We default
 	//! to the page size, which is 4KB. (1 << 12)
 	constexpr static idx_t FILE_HEADER_SIZE = 4096U;
-	//! The number of rows per row group (must be a multiple of the vector size)
+	//! The default number of rows per row group (must be a multiple of the vector size)
 	constexpr static const idx_t ROW_GROUP_SIZE = STANDARD_ROW_GROUPS_SIZE;
 	//! The number of vectors per row group
 	constexpr static const idx_t ROW_GROUP_VECTOR_COUNT = ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE;
+	//! The maximum number of rows per row group that can be configured for a table (must be a multiple of the vector
+	//! size)
+	constexpr static const idx_t MAX_ROW_GROUP_SIZE = idx_t(1) << 30;
 };
 
 //! The version number of the database storage format
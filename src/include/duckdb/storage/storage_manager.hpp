@@ -33,6 +33,12 @@ public:
 
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	// Write the commit without waiting for it to become persistent
+	// Returns true if the WAL still has to be synced to disk for the commit to be persistent
+	virtual bool WriteCommit() {
+		FlushCommit();
+		return false;
+	}
 };
 
 struct CheckpointOptions {
@@ -165,6 +165,9 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics();
 
 protected:
+	//! Checks a filter against statistics that are kept besides the statistics of the column, e.g. the statistics of
+	//! the shredded paths of a JSON column. Returns false if no row of the column can satisfy the filter.
+	virtual bool CheckSubColumnZonemap(TableFilter &filter);
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
 
@@ -21,7 +21,8 @@ struct DataTableInfo {
 	friend class DataTable;
 
 public:
-	DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema, string table);
+	DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema, string table,
+	              idx_t row_group_size);
 
 	//! Initialize any unknown indexes whose types might now be present after an extension load, optionally throwing an
 	//! exception if an index can't be initialized
@@ -44,6 +45,9 @@ public:
 	const vector<IndexStorageInfo> &GetIndexStorageInfo() const {
 		return index_storage_infos;
 	}
+	idx_t GetRowGroupSize() const {
+		return row_group_size;
+	}
 
 	string GetSchemaName();
 	string GetTableName();
@@ -60,6 +64,8 @@ private:
 	string schema;
 	//! The name of the table
 	string table;
+	//! The maximum number of rows per row group of the table
+	idx_t row_group_size;
 	//! The physical list of indexes of this table
 	TableIndexList indexes;
 	//! Index storage information of the indexes created by this table
@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/table/json_column_data.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/table/standard_column_data.hpp"
+#include "duckdb/common/types/vector_buffer.hpp"
+
+namespace duckdb {
+
+//! The shredded paths of a row group of a JSON column
+struct ShreddedJSONColumns {
+	//! The number of rows that were shredded
+	idx_t count = 0;
+	//! The (normalized) paths, e.g. "$.a.b"
+	vector<string> paths;
+	//! The typed sub-column of each path
+	vector<unique_ptr<StandardColumnData>> columns;
+
+public:
+	//! Returns the index of a path, or DConstants::INVALID_INDEX if the path was not shredded
+	idx_t FindPath(const string &path) const;
+};
+
+//! JSON column data is the column data of a top-level JSON column. Besides the JSON text, frequently occurring paths
+//! with a consistent scalar type are stored in hidden typed sub-columns ("shredded") when the row group is
+//! checkpointed. The sub-columns are compressed like regular columns, and their statistics are used to prune row
+//! groups for filters on these paths. Scans attach the sub-columns to the scanned vectors, so that the JSON functions
+//! can read the values of a path without parsing the documents.
+class JSONColumnData : public StandardColumnData {
+public:
+	JSONColumnData(BlockManager &block_manager, DataTableInfo &info, idx_t column_index, idx_t start_row,
+	               LogicalType type);
+
+	//! The maximum nesting depth of the shredded paths
+	static constexpr const idx_t MAX_SHREDDED_DEPTH = 3;
+	//! The maximum number of paths that are considered for shredding
+	static constexpr const idx_t MAX_SHREDDING_CANDIDATES = 32;
+	//! The maximum number of shredded paths per row group
+	static constexpr const idx_t MAX_SHREDDED_PATHS = 16;
+
+public:
+	void SetStart(idx_t new_start) override;
+
+	idx_t Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+	           idx_t target_count) override;
+
+	void CommitDropColumn() override;
+
+	unique_ptr<ColumnCheckpointState> CreateCheckpointState(RowGroup &row_group,
+	                                                        PartialBlockManager &partial_block_manager) override;
+	unique_ptr<ColumnCheckpointState> Checkpoint(RowGroup &row_group, ColumnCheckpointInfo &info) override;
+
+	void GetColumnSegmentInfo(idx_t row_group_index, vector<idx_t> col_path,
+	                          vector<ColumnSegmentInfo> &result) override;
+
+	void DeserializeColumn(Deserializer &deserializer, BaseStatistics &target_stats) override;
+
+	void Verify(RowGroup &parent) override;
+
+	//! Normalizes a constant JSON path (e.g. '$.a.b', '/a/b' or 'a') to the form of the shredded paths. Returns false
+	//! if the path can never refer to a shredded path.
+	static bool TryNormalizePath(const string &path, string &result);
+
+protected:
+	bool CheckSubColumnZonemap(TableFilter &filter) override;
+
+private:
+	//! Whether the shredded paths can be used for the first "row_count" rows of the row group
+	bool CanUseShreddedPaths(idx_t row_count);
+	//! Whether the column was modified since it was last checkpointed
+	bool HasChanges();
+	//! Shreds the committed data of the column, returns nullptr if no path qualifies
+	shared_ptr<ShreddedJSONColumns> ShredColumn();
+
+private:
+	//! The shredded paths of this row group (if any)
+	shared_ptr<ShreddedJSONColumns> shredded;
+};
+
+struct JSONColumnCheckpointState : public StandardColumnCheckpointState {
+	JSONColumnCheckpointState(RowGroup &row_group, ColumnData &column_data, PartialBlockManager &partial_block_manager);
+
+	vector<string> shredded_paths;
+	vector<LogicalType> shredded_types;
+	vector<unique_ptr<ColumnCheckpointState>> shredded_states;
+
+public:
+	void WriteDataPointers(RowGroupWriter &writer, Serializer &serializer) override;
+};
+
+//! The shredded paths of a scanned JSON vector, attached to the string heap of the vector
+struct ShreddedJSONAuxiliaryData : public VectorAuxiliaryData {
+	static constexpr const VectorAuxiliaryDataType TYPE = VectorAuxiliaryDataType::SHREDDED_JSON;
+
+	ShreddedJSONAuxiliaryData(shared_ptr<ShreddedJSONColumns> columns, data_ptr_t vector_data,
+	                          idx_t offset_in_row_group, idx_t count);
+
+	//! The shredded paths of the row group the vector was scanned from
+	shared_ptr<ShreddedJSONColumns> columns;
+	//! The data of the vector, used to verify that the auxiliary data belongs to the vector it is found in
+	data_ptr_t vector_data;
+	//! The offset of the vector in the row group
+	idx_t offset_in_row_group;
+	//! The number of rows of the vector
+	idx_t count;
+
+public:
+	//! Returns the shredded paths of a flat JSON vector, if it has any
+	static optional_ptr<ShreddedJSONAuxiliaryData> Get(Vector &vector);
+	//! Scans the values of a (normalized) path as VARCHAR, i.e. as json_extract_string would return them. Returns
+	//! false if the path was not shredded.
+	bool TryScan(const string &path, Vector &result);
+};
+
+} // namespace duckdb
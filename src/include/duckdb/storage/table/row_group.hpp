@@ -154,6 +154,13 @@ public:
 	idx_t GetAllocationSize() const {
 		return allocation_size;
 	}
+	//! Whether or not the rows of the row group are sorted on the sort keys of the table
+	bool IsSorted() const {
+		return is_sorted;
+	}
+	void SetSorted(bool sorted) {
+		is_sorted = sorted;
+	}
 
 	void Verify();
 
@@ -188,6 +195,8 @@ private:
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
 	idx_t allocation_size;
+	//! Whether or not the rows are sorted on the sort keys of the table - cleared by appends and updates
+	atomic<bool> is_sorted;
 };
 
 } // namespace duckdb
@@ -12,6 +12,7 @@
 #include "duckdb/storage/table/segment_tree.hpp"
 #include "duckdb/storage/statistics/column_statistics.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
+#include "duckdb/common/enums/order_type.hpp"
 
 namespace duckdb {
 
@@ -32,6 +33,20 @@ class MetadataManager;
 struct VacuumState;
 struct CollectionCheckpointState;
 
+//! A column the rows of a table are sorted on when the table is checkpointed
+struct TableSortKey {
+	TableSortKey(PhysicalIndex column, OrderType type, OrderByNullType null_order)
+	    : column(column), type(type), null_order(null_order) {
+	}
+
+	//! The physical column to sort on
+	PhysicalIndex column;
+	//! Sort order, ASC or DESC
+	OrderType type;
+	//! The NULL sort order, NULLS_FIRST or NULLS_LAST
+	OrderByNullType null_order;
+};
+
 class RowGroupCollection {
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
@@ -40,6 +55,19 @@ public:
 public:
 	idx_t GetTotalRows() const;
 	Allocator &GetAllocator() const;
+	//! The maximum number of rows per row group in this collection
+	idx_t GetRowGroupSize() const {
+		return row_group_size;
+	}
+	//! The keys the rows of this collection are sorted on when it is checkpointed (if any)
+	const vector<TableSortKey> &GetSortKeys() const {
+		return sort_keys;
+	}
+	void SetSortKeys(vector<TableSortKey> sort_keys_p) {
+		sort_keys = std::move(sort_keys_p);
+	}
+	//! Returns how many of the leading sort keys hold across all row groups, i.e. for a scan in row group order
+	idx_t GetGloballySortedKeyCount();
 
 	void Initialize(PersistentTableData &data);
 	void InitializeEmpty();
@@ -138,6 +166,10 @@ private:
 	//! The column types of the row group collection
 	vector<LogicalType> types;
 	idx_t row_start;
+	//! The maximum number of rows per row group
+	idx_t row_group_size;
+	//! The keys the rows are sorted on when the collection is checkpointed
+	vector<TableSortKey> sort_keys;
 	//! The segment trees holding the various row_groups of the table
 	shared_ptr<RowGroupSegmentTree> row_groups;
 	//! Table statistics
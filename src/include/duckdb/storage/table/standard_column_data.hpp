@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/validity_column_data.hpp"
 
 namespace duckdb {
@@ -64,4 +65,15 @@ public:
 	void Verify(RowGroup &parent) override;
 };
 
+struct StandardColumnCheckpointState : public ColumnCheckpointState {
+	StandardColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
+	                              PartialBlockManager &partial_block_manager);
+
+	unique_ptr<ColumnCheckpointState> validity_state;
+
+public:
+	unique_ptr<BaseStatistics> GetStatistics() override;
+	void WriteDataPointers(RowGroupWriter &writer, Serializer &serializer) override;
+};
+
 } // namespace duckdb
@@ -101,7 +101,15 @@ struct UpdateNodeData {
 };
 
 struct UpdateNode {
-	unique_ptr<UpdateNodeData> info[Storage::ROW_GROUP_VECTOR_COUNT];
+	//! The update data per vector of the row group, grown on demand as vectors are updated
+	vector<unique_ptr<UpdateNodeData>> info;
+
+	optional_ptr<UpdateNodeData> GetVectorData(idx_t vector_index) const {
+		if (vector_index >= info.size()) {
+			return nullptr;
+		}
+		return info[vector_index].get();
+	}
 };
 
 } // namespace duckdb
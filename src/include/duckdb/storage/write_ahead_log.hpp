@@ -115,7 +115,11 @@ public:
 	void Truncate(int64_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Ends the entries of a commit and syncs the WAL to disk
 	void Flush();
+	//! Ends the entries of a commit without syncing the WAL to disk: the commit only becomes durable once the
+	//! buffered entries have been written and the file has been synced (see GetWriter())
+	void WriteFlushMarker();
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
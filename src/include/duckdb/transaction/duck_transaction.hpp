@@ -31,6 +31,8 @@ public:
 	transaction_t commit_id;
 	//! Highest active query when the transaction finished, used for cleaning up
 	transaction_t highest_active_query;
+	//! Whether the commit of this transaction has been written to the WAL, but still has to be synced to disk
+	bool requires_wal_sync = false;
 
 public:
 	static DuckTransaction &Get(ClientContext &context, AttachedDatabase &db);
@@ -12,6 +12,8 @@
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class DuckTransaction;
 
@@ -71,6 +73,9 @@ private:
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction, bool store_transaction) noexcept;
 
+	//! Waits until the given number of commits written to the WAL have been synced to disk (group commit)
+	void SyncWAL(idx_t commit_count);
+
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
@@ -99,6 +104,19 @@ private:
 	//! Lock necessary to start transactions only - used by FORCE CHECKPOINT to prevent new transactions from starting
 	mutex start_transaction_lock;
 
+	//! Group commit: commits write their WAL entries while holding the transaction lock, but the WAL is synced to
+	//! disk outside of it, by a single thread on behalf of all commits that have been written so far
+	//! The number of commits written to the WAL (protected by the transaction lock)
+	idx_t wal_commits_written = 0;
+	//! Lock protecting the sync state below
+	mutex wal_sync_lock;
+	//! Signalled when a sync of the WAL has finished
+	std::condition_variable wal_sync_done;
+	//! The number of commits that have been synced to disk
+	idx_t wal_commits_synced = 0;
+	//! Whether a thread is currently syncing the WAL
+	bool wal_sync_active = false;
+
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
 	}
@@ -21,6 +21,7 @@
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_tracer.hpp"
 #include "duckdb/main/query_result.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
@@ -194,6 +195,7 @@ void ClientContext::BeginQueryInternal(ClientContextLock &lock, const string &qu
 	transaction.SetActiveQuery(db->GetDatabaseManager().GetNewQueryNumber());
 	LogQueryInternal(lock, query);
 	active_query->query = query;
+	client_data->tracer->StartQuery(query);
 
 	query_progress.Initialize();
 	// Notify any registered state of query begin
@@ -241,6 +243,14 @@ ErrorData ClientContext::EndQueryInternal(ClientContextLock &lock, bool success,
 	} catch (...) { // LCOV_EXCL_START
 		error = ErrorData("Unhandled exception!");
 	} // LCOV_EXCL_STOP
+	try {
+		// the tasks of the query have all finished, so the trace is complete
+		client_data->tracer->EndQuery();
+	} catch (std::exception &ex) {
+		if (!error.HasError()) {
+			error = ErrorData(ex);
+		}
+	}
 	return error;
 }
 
@@ -358,6 +368,9 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 	// now convert logical query plan into a physical query plan
 	PhysicalPlanGenerator physical_planner(*this);
 	auto physical_plan = physical_planner.CreatePlan(std::move(plan));
+	if (physical_planner.requires_rebind) {
+		result->properties.always_require_rebind = true;
+	}
 	profiler.EndPhase();
 
 #ifdef DEBUG
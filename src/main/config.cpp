@@ -82,6 +82,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
+    DUCKDB_LOCAL(EnableHardwareCountersSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
@@ -106,6 +107,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL_ALIAS("memory_limit", MaximumMemorySetting),
     DUCKDB_GLOBAL_ALIAS("null_order", DefaultNullOrderSetting),
     DUCKDB_LOCAL(OrderedAggregateThreshold),
+    DUCKDB_LOCAL(QuantileSortThreshold),
     DUCKDB_GLOBAL(PasswordSetting),
     DUCKDB_LOCAL(PerfectHashThresholdSetting),
     DUCKDB_LOCAL(PivotFilterThreshold),
@@ -122,6 +124,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
     DUCKDB_GLOBAL(ThreadsSetting),
+    DUCKDB_LOCAL(TraceOutputSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
@@ -22,6 +22,33 @@
 
 namespace duckdb {
 
+struct OperatorMetricsCollector {
+	//! Whether the thread is executing a profiled operator
+	bool active = false;
+	OperatorMetrics metrics;
+};
+
+//! The metrics collected by each thread for the operator it is executing: low-level code (e.g. file reads and the
+//! scans of the storage) adds to these without knowing about the operator or the profiler
+static thread_local OperatorMetricsCollector metrics_collector;
+
+optional_ptr<OperatorMetrics> OperatorMetrics::Active() {
+	if (!metrics_collector.active) {
+		return nullptr;
+	}
+	return &metrics_collector.metrics;
+}
+
+void OperatorMetrics::StartCollecting() {
+	metrics_collector.active = true;
+	metrics_collector.metrics = OperatorMetrics();
+}
+
+OperatorMetrics OperatorMetrics::StopCollecting() {
+	metrics_collector.active = false;
+	return metrics_collector.metrics;
+}
+
 QueryProfiler::QueryProfiler(ClientContext &context_p)
     : context(context_p), running(false), query_requires_profiling(false), is_explain_analyze(false) {
 }
@@ -72,6 +99,7 @@ void QueryProfiler::StartQuery(string query, bool is_explain_analyze, bool start
 	root = nullptr;
 	phase_timings.clear();
 	phase_stack.clear();
+	thread_busy_times.clear();
 
 	main_query.Start();
 }
@@ -226,7 +254,8 @@ void QueryProfiler::Initialize(const PhysicalOperator &root_op) {
 	}
 }
 
-OperatorProfiler::OperatorProfiler(bool enabled_p) : enabled(enabled_p), active_operator(nullptr) {
+OperatorProfiler::OperatorProfiler(bool enabled_p, bool hardware_counters_p)
+    : enabled(enabled_p), hardware_counters(enabled_p && hardware_counters_p), active_operator(nullptr) {
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -241,6 +270,10 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 	active_operator = phys_op;
 
 	// start timing for current element
+	OperatorMetrics::StartCollecting();
+	if (hardware_counters) {
+		counters_started = HardwareCounters::Read(counters_start);
+	}
 	op.Start();
 }
 
@@ -255,28 +288,49 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 
 	// finish timing for the current element
 	op.End();
-
-	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0);
+	auto metrics = OperatorMetrics::StopCollecting();
+	HardwareCounterValues counters_end;
+	if (counters_started && HardwareCounters::Read(counters_end)) {
+		auto counted = counters_end.Subtract(counters_start);
+		metrics.cpu_cycles = counted.cpu_cycles;
+		metrics.instructions = counted.instructions;
+		metrics.cache_misses = counted.cache_misses;
+		metrics.branch_misses = counted.branch_misses;
+	}
+	counters_started = false;
+
+	AddTiming(*active_operator, op.Elapsed(), chunk ? chunk->size() : 0, metrics);
 	active_operator = nullptr;
 }
 
-void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements) {
+void OperatorProfiler::AddTiming(const PhysicalOperator &op, double time, idx_t elements,
+                                 const OperatorMetrics &metrics) {
 	if (!enabled) {
 		return;
 	}
 	if (!Value::DoubleIsFinite(time)) {
 		return;
 	}
+	busy_time += time;
 	auto entry = timings.find(op);
 	if (entry == timings.end()) {
 		// add new entry
 		timings[op] = OperatorInformation(time, elements);
+		timings[op].metrics = metrics;
 	} else {
 		// add to existing entry
 		entry->second.time += time;
 		entry->second.elements += elements;
+		entry->second.metrics.Combine(metrics);
 	}
 }
+
+void OperatorProfiler::AddMetrics(const PhysicalOperator &phys_op, const OperatorMetrics &metrics) {
+	if (!enabled) {
+		return;
+	}
+	timings[phys_op].metrics.Combine(metrics);
+}
 void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor,
                              const string &name, int id) {
 	auto entry = timings.find(phys_op);
@@ -300,11 +354,35 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 
 		tree_node.info.time += node.second.time;
 		tree_node.info.elements += node.second.elements;
+		tree_node.info.metrics.Combine(node.second.metrics);
 		if (!IsDetailedEnabled()) {
 			continue;
 		}
 	}
 	profiler.timings.clear();
+
+	// the profiler is flushed by the thread that used it
+	const auto thread_id = std::this_thread::get_id();
+	auto entry = std::find_if(thread_busy_times.begin(), thread_busy_times.end(),
+	                          [&](const pair<std::thread::id, double> &busy) { return busy.first == thread_id; });
+	if (entry == thread_busy_times.end()) {
+		thread_busy_times.emplace_back(thread_id, profiler.busy_time);
+	} else {
+		entry->second += profiler.busy_time;
+	}
+	profiler.busy_time = 0;
+}
+
+void QueryProfiler::AddMetrics(const PhysicalOperator &phys_op, const OperatorMetrics &metrics) {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	auto entry = tree_map.find(phys_op);
+	if (entry == tree_map.end()) {
+		return;
+	}
+	entry->second.get().info.metrics.Combine(metrics);
 }
 
 static string DrawPadded(const string &str, idx_t width) {
@@ -400,6 +478,7 @@ void QueryProfiler::QueryTreeToStream(std::ostream &ss) const {
 	ss << "││" + DrawPadded(total_time, TOTAL_BOX_WIDTH - 4) + "││\n";
 	ss << "│└───────────────────────────────────┘│\n";
 	ss << "└─────────────────────────────────────┘\n";
+	RenderThreadTimings(ss);
 	// print phase timings
 	if (PrintOptimizerOutput()) {
 		bool has_previous_phase = false;
@@ -436,6 +515,26 @@ void QueryProfiler::QueryTreeToStream(std::ostream &ss) const {
 	}
 }
 
+void QueryProfiler::RenderThreadTimings(std::ostream &ss) const {
+	if (thread_busy_times.empty()) {
+		return;
+	}
+	constexpr idx_t TOTAL_BOX_WIDTH = 39;
+	const auto total_time = main_query.Elapsed();
+	ss << "┌─────────────────────────────────────┐\n";
+	ss << "│┌───────────────────────────────────┐│\n";
+	ss << "││          Thread Timings:          ││\n";
+	ss << "││                                   ││\n";
+	for (idx_t thread_idx = 0; thread_idx < thread_busy_times.size(); thread_idx++) {
+		const auto busy = thread_busy_times[thread_idx].second;
+		const auto idle = MaxValue<double>(total_time - busy, 0);
+		string timings = "#" + to_string(thread_idx) + " busy: " + RenderTiming(busy) + " idle: " + RenderTiming(idle);
+		ss << "││" + DrawPadded(timings, TOTAL_BOX_WIDTH - 4) + "││\n";
+	}
+	ss << "│└───────────────────────────────────┘│\n";
+	ss << "└─────────────────────────────────────┘\n";
+}
+
 static string JSONSanitize(const string &text) {
 	string result;
 	result.reserve(text.size());
@@ -475,6 +574,18 @@ static void ToJSONRecursive(QueryProfiler::TreeNode &node, std::ostream &ss, idx
 	ss << string(depth * 3, ' ') << "   \"name\": \"" + JSONSanitize(node.name) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"timing\":" + to_string(node.info.time) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"cardinality\":" + to_string(node.info.elements) + ",\n";
+	auto &metrics = node.info.metrics;
+	ss << string(depth * 3, ' ') << "   \"bytes_read\":" + to_string(metrics.bytes_read) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"rows_pruned\":" + to_string(metrics.rows_pruned) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"hash_table_entries\":" + to_string(metrics.hash_table_entries) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"hash_table_capacity\":" + to_string(metrics.hash_table_capacity) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"bytes_spilled\":" + to_string(metrics.bytes_spilled) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"bytes_reloaded\":" + to_string(metrics.bytes_reloaded) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"peak_memory\":" + to_string(metrics.peak_memory) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"cpu_cycles\":" + to_string(metrics.cpu_cycles) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"instructions\":" + to_string(metrics.instructions) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"cache_misses\":" + to_string(metrics.cache_misses) + ",\n";
+	ss << string(depth * 3, ' ') << "   \"branch_misses\":" + to_string(metrics.branch_misses) + ",\n";
 	ss << string(depth * 3, ' ') << "   \"extra_info\": \"" + JSONSanitize(node.extra_info) + "\",\n";
 	ss << string(depth * 3, ' ') << "   \"children\": [\n";
 	if (node.children.empty()) {
@@ -524,6 +635,20 @@ string QueryProfiler::ToJSON() const {
 	}
 	ss << "\n";
 	ss << "   ],\n";
+	// print the time each thread spent executing operators
+	ss << "   \"threads\": [\n";
+	for (idx_t i = 0; i < thread_busy_times.size(); i++) {
+		if (i > 0) {
+			ss << ",\n";
+		}
+		const auto busy = thread_busy_times[i].second;
+		ss << "   {\n";
+		ss << "   \"busy\": " + to_string(busy) + ",\n";
+		ss << "   \"idle\": " + to_string(MaxValue<double>(main_query.Elapsed() - busy, 0)) + "\n";
+		ss << "   }";
+	}
+	ss << "\n";
+	ss << "   ],\n";
 	// recursively print the physical operator tree
 	ss << "   \"children\": [\n";
 	ToJSONRecursive(*root, ss);
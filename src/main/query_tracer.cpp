@@ -0,0 +1,255 @@
+#include "duckdb/main/query_tracer.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/fstream.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+TraceBuffer::TraceBuffer(idx_t thread_idx) : thread_idx(thread_idx) {
+}
+
+void TraceBuffer::Append(TraceEvent event) {
+	if (events.size() < CAPACITY) {
+		events.push_back(std::move(event));
+	} else {
+		events[event_count % CAPACITY] = std::move(event);
+	}
+	event_count++;
+}
+
+//! The tracing state of a thread
+struct ThreadTraceState {
+	//! The buffer that the thread records its events in, or nullptr if the thread does not record events
+	optional_ptr<TraceBuffer> buffer;
+	//! The start of the query that the thread records events for
+	int64_t query_start = 0;
+	//! The buffer that the thread used last, which is reused as long as it traces the same query
+	optional_ptr<QueryTracer> cached_tracer;
+	idx_t cached_query_id = 0;
+	optional_ptr<TraceBuffer> cached_buffer;
+	//! The time at which the thread started waiting for a task, or -1 if it is not waiting
+	int64_t waiting_since = -1;
+};
+
+static thread_local ThreadTraceState thread_trace_state;
+
+//! The identifiers of traced queries are unique over all tracers, so a cached buffer can never be confused with the
+//! buffer of another tracer
+static atomic<idx_t> next_trace_query_id {1};
+
+QueryTracer::QueryTracer(ClientContext &context) : context(context) {
+}
+
+QueryTracer &QueryTracer::Get(ClientContext &context) {
+	return *ClientData::Get(context).tracer;
+}
+
+void QueryTracer::StartQuery(const string &query_p) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.trace_output.empty()) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	buffers.clear();
+	query = query_p;
+	query_id = next_trace_query_id++;
+	query_start = Now();
+	enabled = true;
+}
+
+void QueryTracer::EndQuery() {
+	if (!enabled) {
+		return;
+	}
+	enabled = false;
+	auto &config = ClientConfig::GetConfig(context);
+	if (!config.trace_output.empty()) {
+		ofstream out(config.trace_output);
+		out << ToJSON();
+		out.close();
+		if (out.fail()) {
+			throw IOException("Could not write query trace to \"%s\": %s", config.trace_output, strerror(errno));
+		}
+	}
+	lock_guard<mutex> guard(lock);
+	buffers.clear();
+}
+
+static string EscapeTraceString(const string &text) {
+	string result;
+	result.reserve(text.size());
+	for (auto c : text) {
+		switch (c) {
+		case '"':
+			result += "\\\"";
+			break;
+		case '\\':
+			result += "\\\\";
+			break;
+		case '\n':
+			result += "\\n";
+			break;
+		case '\r':
+			result += "\\r";
+			break;
+		case '\t':
+			result += "\\t";
+			break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {
+				result += StringUtil::Format("\\u%04x", int(c));
+			} else {
+				result += c;
+			}
+			break;
+		}
+	}
+	return result;
+}
+
+//! Renders a timestamp relative to the start of the query in microseconds, the unit of the trace event format
+static string RenderTraceTimestamp(int64_t time) {
+	return StringUtil::Format("%.3f", double(time) / 1000.0);
+}
+
+string QueryTracer::ToJSON() const {
+	vector<reference<TraceBuffer>> thread_buffers;
+	for (auto &entry : buffers) {
+		thread_buffers.push_back(*entry.second);
+	}
+	std::sort(thread_buffers.begin(), thread_buffers.end(),
+	          [](const TraceBuffer &a, const TraceBuffer &b) { return a.thread_idx < b.thread_idx; });
+
+	string result = "{\n\"traceEvents\": [\n";
+	result += "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, \"args\": {\"name\": \"DuckDB\"}}";
+	idx_t dropped_events = 0;
+	for (auto &buffer_ref : thread_buffers) {
+		auto &buffer = buffer_ref.get();
+		auto tid = to_string(buffer.thread_idx);
+		result += ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " + tid +
+		          ", \"args\": {\"name\": \"thread " + tid + "\"}}";
+
+		// the oldest events were overwritten if the ring buffer wrapped around
+		const auto stored = buffer.events.size();
+		const auto first = buffer.event_count - stored;
+		dropped_events += first;
+		for (idx_t i = first; i < buffer.event_count; i++) {
+			auto &event = buffer.events[i % TraceBuffer::CAPACITY];
+			result += ",\n{\"name\": \"" + string(event.name) + "\", \"cat\": \"" + string(event.category) + "\"";
+			result += ", \"pid\": 0, \"tid\": " + tid;
+			result += ", \"ts\": " + RenderTraceTimestamp(event.start - query_start);
+			if (event.instant) {
+				result += ", \"ph\": \"i\", \"s\": \"t\"";
+			} else {
+				result += ", \"ph\": \"X\", \"dur\": " + RenderTraceTimestamp(event.end - event.start);
+			}
+			if (!event.detail.empty()) {
+				result += ", \"args\": {\"detail\": \"" + EscapeTraceString(event.detail) + "\"}";
+			}
+			result += "}";
+		}
+	}
+	result += "\n],\n\"displayTimeUnit\": \"ms\",\n";
+	result += "\"otherData\": {\"query\": \"" + EscapeTraceString(query) +
+	          "\", \"dropped_events\": " + to_string(dropped_events) + "}\n}\n";
+	return result;
+}
+
+int64_t QueryTracer::Now() {
+	auto now = std::chrono::steady_clock::now().time_since_epoch();
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+bool QueryTracer::IsActive() {
+	return thread_trace_state.buffer != nullptr;
+}
+
+void QueryTracer::AddEvent(const char *category, const char *name, int64_t start, string detail) {
+	auto &state = thread_trace_state;
+	if (!state.buffer) {
+		return;
+	}
+	TraceEvent event;
+	event.category = category;
+	event.name = name;
+	event.start = MaxValue(start, state.query_start);
+	event.end = MaxValue(Now(), event.start);
+	event.detail = std::move(detail);
+	state.buffer->Append(std::move(event));
+}
+
+void QueryTracer::AddInstantEvent(const char *category, const char *name, string detail) {
+	auto &state = thread_trace_state;
+	if (!state.buffer) {
+		return;
+	}
+	TraceEvent event;
+	event.category = category;
+	event.name = name;
+	event.start = Now();
+	event.end = event.start;
+	event.instant = true;
+	event.detail = std::move(detail);
+	state.buffer->Append(std::move(event));
+}
+
+void QueryTracer::StartWaiting() {
+	auto &state = thread_trace_state;
+	if (state.waiting_since < 0) {
+		state.waiting_since = Now();
+	}
+}
+
+TraceBuffer &QueryTracer::GetThreadBuffer() {
+	auto &state = thread_trace_state;
+	if (state.cached_tracer.get() == this && state.cached_query_id == query_id) {
+		return *state.cached_buffer;
+	}
+	lock_guard<mutex> guard(lock);
+	auto &buffer = buffers[std::this_thread::get_id()];
+	if (!buffer) {
+		buffer = make_uniq<TraceBuffer>(buffers.size() - 1);
+	}
+	state.cached_tracer = this;
+	state.cached_query_id = query_id;
+	state.cached_buffer = buffer.get();
+	return *buffer;
+}
+
+QueryTracerScope::QueryTracerScope(ClientContext &context) {
+	auto &state = thread_trace_state;
+	auto waiting_since = state.waiting_since;
+	state.waiting_since = -1;
+
+	auto &tracer = QueryTracer::Get(context);
+	if (!tracer.IsEnabled()) {
+		return;
+	}
+	active = true;
+	previous_buffer = state.buffer;
+	previous_query_start = state.query_start;
+	state.buffer = tracer.GetThreadBuffer();
+	state.query_start = tracer.query_start;
+	if (waiting_since >= 0) {
+		// the thread was waiting for this task in the scheduler
+		QueryTracer::AddEvent("scheduler", "wait for task", waiting_since);
+	}
+}
+
+QueryTracerScope::~QueryTracerScope() {
+	if (!active) {
+		return;
+	}
+	auto &state = thread_trace_state;
+	state.buffer = previous_buffer;
+	state.query_start = previous_query_start;
+}
+
+} // namespace duckdb
@@ -184,6 +184,21 @@ Value OrderedAggregateThreshold::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(ClientConfig::GetConfig(context).ordered_aggregate_threshold);
 }
 
+//===--------------------------------------------------------------------===//
+// Quantile Sort Threshold
+//===--------------------------------------------------------------------===//
+void QuantileSortThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).quantile_sort_threshold = ClientConfig().quantile_sort_threshold;
+}
+
+void QuantileSortThreshold::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).quantile_sort_threshold = input.GetValue<uint64_t>();
+}
+
+Value QuantileSortThreshold::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).quantile_sort_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Window Mode
 //===--------------------------------------------------------------------===//
@@ -630,6 +645,21 @@ Value EnableHTTPMetadataCacheSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.http_metadata_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Hardware Counters
+//===--------------------------------------------------------------------===//
+void EnableHardwareCountersSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_hardware_counters = BooleanValue::Get(input);
+}
+
+void EnableHardwareCountersSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_hardware_counters = ClientConfig().enable_hardware_counters;
+}
+
+Value EnableHardwareCountersSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_hardware_counters);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable Profiling
 //===--------------------------------------------------------------------===//
@@ -1417,6 +1447,21 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Trace Output
+//===--------------------------------------------------------------------===//
+void TraceOutputSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).trace_output = input.ToString();
+}
+
+void TraceOutputSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).trace_output = ClientConfig().trace_output;
+}
+
+Value TraceOutputSetting::GetSetting(const ClientContext &context) {
+	return Value(ClientConfig::GetConfig(context).trace_output);
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -124,6 +124,12 @@ void ColumnLifetimeAnalyzer::VisitOperator(LogicalOperator &op) {
 		everything_referenced = true;
 		break;
 	}
+	case LogicalOperatorType::LOGICAL_GET:
+		// table in-out function: all input columns are consumed by the function
+		if (!op.children.empty()) {
+			everything_referenced = true;
+		}
+		break;
 	case LogicalOperatorType::LOGICAL_FILTER: {
 		auto &filter = op.Cast<LogicalFilter>();
 		if (everything_referenced) {
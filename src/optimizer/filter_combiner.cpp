@@ -12,9 +12,11 @@
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/json_path_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/storage/table/json_column_data.hpp"
 
 namespace duckdb {
 
@@ -435,6 +437,81 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
+// Matches an extraction of a constant path from a JSON column, i.e. json_extract_string(j, '$.a') or j->>'$.a',
+// optionally cast to an integral or boolean type. Returns the type the compared constant must be converted to.
+static bool TryGetJSONPathExtract(const vector<idx_t> &column_ids, const Expression &expr, idx_t &column_index,
+                                  string &path, LogicalType &constant_type) {
+	reference<const Expression> extract_expr(expr);
+	constant_type = LogicalType::VARCHAR;
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_CAST) {
+		auto &cast = expr.Cast<BoundCastExpression>();
+		if (!cast.return_type.IsIntegral() && cast.return_type.id() != LogicalTypeId::BOOLEAN) {
+			return false;
+		}
+		constant_type = cast.return_type.IsIntegral() ? LogicalType::BIGINT : LogicalType::BOOLEAN;
+		extract_expr = *cast.child;
+	}
+	if (extract_expr.get().GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func = extract_expr.get().Cast<BoundFunctionExpression>();
+	if (func.function.name != "json_extract_string" && func.function.name != "json_extract_path_text" &&
+	    func.function.name != "->>") {
+		return false;
+	}
+	if (func.children.size() != 2 || func.children[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+	    !func.children[0]->return_type.IsJSONType() || func.children[1]->type != ExpressionType::VALUE_CONSTANT) {
+		return false;
+	}
+	auto &path_value = func.children[1]->Cast<BoundConstantExpression>().value;
+	if (path_value.IsNull() || path_value.type().id() != LogicalTypeId::VARCHAR) {
+		return false;
+	}
+	if (!JSONColumnData::TryNormalizePath(StringValue::Get(path_value), path)) {
+		return false;
+	}
+	auto &column_ref = func.children[0]->Cast<BoundColumnRefExpression>();
+	column_index = column_ids[column_ref.binding.column_index];
+	return column_index != COLUMN_IDENTIFIER_ROW_ID;
+}
+
+void FilterCombiner::GenerateJSONPathFilters(vector<idx_t> &column_ids, TableFilterSet &table_filters) {
+	for (auto &entry : equivalence_map) {
+		if (entry.second.size() != 1) {
+			continue;
+		}
+		idx_t column_index;
+		string path;
+		LogicalType constant_type;
+		if (!TryGetJSONPathExtract(column_ids, entry.second[0].get(), column_index, path, constant_type)) {
+			continue;
+		}
+		auto constant_list = constant_values.find(entry.first);
+		if (constant_list == constant_values.end()) {
+			continue;
+		}
+		for (auto &constant_cmp : constant_list->second) {
+			switch (constant_cmp.comparison_type) {
+			case ExpressionType::COMPARE_EQUAL:
+			case ExpressionType::COMPARE_GREATERTHAN:
+			case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			case ExpressionType::COMPARE_LESSTHAN:
+			case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+				break;
+			default:
+				continue;
+			}
+			Value constant;
+			if (constant_cmp.constant.IsNull() ||
+			    !constant_cmp.constant.DefaultTryCastAs(constant_type, constant, nullptr, true)) {
+				continue;
+			}
+			auto constant_filter = make_uniq<ConstantFilter>(constant_cmp.comparison_type, std::move(constant));
+			table_filters.PushFilter(column_index, make_uniq<JSONPathFilter>(path, std::move(constant_filter)));
+		}
+	}
+}
+
 TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_ids) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
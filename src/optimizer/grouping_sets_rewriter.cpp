@@ -0,0 +1,199 @@
+#include "duckdb/optimizer/grouping_sets_rewriter.hpp"
+
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+
+namespace duckdb {
+
+GroupingSetsRewriter::GroupingSetsRewriter(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<Expression> GroupingSetsRewriter::BindScalarFunction(const string &name,
+                                                                vector<unique_ptr<Expression>> children) {
+	FunctionBinder binder(optimizer.context);
+	ErrorData error;
+	auto result = binder.BindScalarFunction(DEFAULT_SCHEMA, name, std::move(children), error);
+	if (!result) {
+		error.Throw();
+	}
+	return result;
+}
+
+unique_ptr<Expression> GroupingSetsRewriter::BindAggregateFunction(const string &name,
+                                                                   vector<unique_ptr<Expression>> children,
+                                                                   unique_ptr<Expression> filter) {
+	QueryErrorContext error_context;
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(optimizer.context, SYSTEM_CATALOG, DEFAULT_SCHEMA,
+	                                                              name, error_context);
+	vector<LogicalType> types;
+	for (const auto &child : children) {
+		types.emplace_back(child->return_type);
+	}
+	FunctionBinder binder(optimizer.context);
+	ErrorData error;
+	auto best_function = binder.BindFunction(func.name, func.functions, types, error);
+	if (!best_function.IsValid()) {
+		error.Throw();
+	}
+	auto bound_function = func.functions.GetFunctionByOffset(best_function.GetIndex());
+	return binder.BindAggregateFunction(bound_function, std::move(children), std::move(filter));
+}
+
+bool GroupingSetsRewriter::CanPreAggregate(BoundAggregateExpression &aggr) {
+	if (aggr.IsDistinct() || aggr.order_bys) {
+		return false;
+	}
+	const auto &name = aggr.function.name;
+	if (name == "count_star") {
+		return true;
+	}
+	if (aggr.children.size() != 1) {
+		return false;
+	}
+	if (name == "count" || name == "min" || name == "max") {
+		return true;
+	}
+	auto &input_type = aggr.children[0]->return_type;
+	if (name == "sum") {
+		return input_type.IsNumeric();
+	}
+	if (name == "avg") {
+		return input_type.IsNumeric() && aggr.return_type.id() == LogicalTypeId::DOUBLE;
+	}
+	return false;
+}
+
+unique_ptr<LogicalOperator> GroupingSetsRewriter::TryRewrite(unique_ptr<LogicalOperator> op) {
+	auto &aggr = op->Cast<LogicalAggregate>();
+	if (aggr.grouping_sets.size() <= 1 || aggr.groups.empty()) {
+		return op;
+	}
+	for (auto &expr : aggr.expressions) {
+		if (!CanPreAggregate(expr->Cast<BoundAggregateExpression>())) {
+			return op;
+		}
+	}
+	auto &binder = optimizer.binder;
+	auto &context = optimizer.context;
+	const auto old_bindings = aggr.GetColumnBindings();
+
+	// the pre-aggregate groups on all groups of the grouping sets
+	const auto pre_group_index = binder.GenerateTableIndex();
+	const auto pre_aggregate_index = binder.GenerateTableIndex();
+	auto pre_aggregate = make_uniq<LogicalAggregate>(pre_group_index, pre_aggregate_index, std::move(aggr.expressions));
+	pre_aggregate->groups = std::move(aggr.groups);
+	for (idx_t group_idx = 0; group_idx < pre_aggregate->groups.size(); group_idx++) {
+		auto &group = *pre_aggregate->groups[group_idx];
+		auto group_binding = ColumnBinding(pre_group_index, group_idx);
+		aggr.groups.push_back(make_uniq<BoundColumnRefExpression>(group.return_type, group_binding));
+	}
+
+	// every grouping set is then computed from the partial aggregates
+	aggr.group_index = binder.GenerateTableIndex();
+	aggr.aggregate_index = binder.GenerateTableIndex();
+	if (aggr.groupings_index != DConstants::INVALID_INDEX) {
+		aggr.groupings_index = binder.GenerateTableIndex();
+	}
+	auto &partials = pre_aggregate->expressions;
+	const auto aggregate_count = partials.size();
+	auto combine = [&](const string &name, idx_t partial_idx) {
+		vector<unique_ptr<Expression>> children;
+		auto &partial_type = partials[partial_idx]->return_type;
+		children.push_back(
+		    make_uniq<BoundColumnRefExpression>(partial_type, ColumnBinding(pre_aggregate_index, partial_idx)));
+		aggr.expressions.push_back(BindAggregateFunction(name, std::move(children), nullptr));
+		const auto aggregate_idx = aggr.expressions.size() - 1;
+		return make_uniq<BoundColumnRefExpression>(aggr.expressions[aggregate_idx]->return_type,
+		                                           ColumnBinding(aggr.aggregate_index, aggregate_idx));
+	};
+
+	vector<unique_ptr<Expression>> projections;
+	for (idx_t group_idx = 0; group_idx < aggr.groups.size(); group_idx++) {
+		projections.push_back(make_uniq<BoundColumnRefExpression>(aggr.groups[group_idx]->return_type,
+		                                                          ColumnBinding(aggr.group_index, group_idx)));
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < aggregate_count; aggr_idx++) {
+		auto &partial = partials[aggr_idx]->Cast<BoundAggregateExpression>();
+		const auto result_type = partial.return_type;
+		const auto name = partial.function.name;
+		unique_ptr<Expression> result;
+		if (name == "count" || name == "count_star") {
+			// counts are summed up, a grouping set without any rows has a count of zero
+			auto coalesce = make_uniq<BoundOperatorExpression>(ExpressionType::OPERATOR_COALESCE, LogicalType::HUGEINT);
+			coalesce->children.push_back(combine("sum", aggr_idx));
+			coalesce->children.push_back(make_uniq<BoundConstantExpression>(Value::HUGEINT(0)));
+			result = std::move(coalesce);
+		} else if (name == "avg") {
+			// the average is split up in a sum and a count
+			vector<unique_ptr<Expression>> count_children;
+			count_children.push_back(partial.children[0]->Copy());
+			auto count_filter = partial.filter ? partial.filter->Copy() : nullptr;
+			auto count_partial = BindAggregateFunction("count", std::move(count_children), std::move(count_filter));
+
+			vector<unique_ptr<Expression>> sum_children;
+			sum_children.push_back(std::move(partial.children[0]));
+			partials[aggr_idx] = BindAggregateFunction("sum", std::move(sum_children), std::move(partial.filter));
+			partials.push_back(std::move(count_partial));
+			auto sum = combine("sum", aggr_idx);
+			auto count = combine("sum", partials.size() - 1);
+
+			vector<unique_ptr<Expression>> children;
+			children.push_back(BoundCastExpression::AddCastToType(context, std::move(sum), LogicalType::DOUBLE));
+			children.push_back(BoundCastExpression::AddCastToType(context, std::move(count), LogicalType::DOUBLE));
+			result = BindScalarFunction("/", std::move(children));
+		} else {
+			// the sum of sums, the minimum of minimums and the maximum of maximums
+			result = combine(name, aggr_idx);
+		}
+		projections.push_back(BoundCastExpression::AddCastToType(context, std::move(result), result_type));
+	}
+	for (idx_t grouping_idx = 0; grouping_idx < aggr.grouping_functions.size(); grouping_idx++) {
+		auto grouping_binding = ColumnBinding(aggr.groupings_index, grouping_idx);
+		projections.push_back(make_uniq<BoundColumnRefExpression>(LogicalType::BIGINT, grouping_binding));
+	}
+
+	pre_aggregate->children.push_back(std::move(aggr.children[0]));
+	pre_aggregate->ResolveOperatorTypes();
+	aggr.children[0] = std::move(pre_aggregate);
+	aggr.ResolveOperatorTypes();
+
+	// the projection takes the place of the original aggregate
+	auto projection = make_uniq<LogicalProjection>(binder.GenerateTableIndex(), std::move(projections));
+	for (idx_t col_idx = 0; col_idx < old_bindings.size(); col_idx++) {
+		replacer.replacement_bindings.emplace_back(old_bindings[col_idx],
+		                                           ColumnBinding(projection->table_index, col_idx));
+	}
+	projection->children.push_back(std::move(op));
+	projection->ResolveOperatorTypes();
+	return std::move(projection);
+}
+
+unique_ptr<LogicalOperator> GroupingSetsRewriter::OptimizeInternal(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = OptimizeInternal(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		return TryRewrite(std::move(op));
+	}
+	return op;
+}
+
+unique_ptr<LogicalOperator> GroupingSetsRewriter::Optimize(unique_ptr<LogicalOperator> op) {
+	op = OptimizeInternal(std::move(op));
+	if (!replacer.replacement_bindings.empty()) {
+		// make the operators that referenced the rewritten aggregates reference the projections instead
+		replacer.VisitOperator(*op);
+	}
+	return op;
+}
+
+} // namespace duckdb
@@ -0,0 +1,219 @@
+#include "duckdb/optimizer/late_materialization.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
+#include "duckdb/planner/operator/logical_top_n.hpp"
+
+namespace duckdb {
+
+LateMaterialization::LateMaterialization(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+//! Replaces references to the output of the projection with (copies of) the projected expressions
+static void InlineProjection(LogicalProjection &projection, unique_ptr<Expression> &expr) {
+	if (expr->type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr->Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index == projection.table_index) {
+			D_ASSERT(colref.binding.column_index < projection.expressions.size());
+			expr = projection.expressions[colref.binding.column_index]->Copy();
+			return;
+		}
+	}
+	ExpressionIterator::EnumerateChildren(
+	    *expr, [&](unique_ptr<Expression> &child) { InlineProjection(projection, child); });
+}
+
+//! Gathers the column indexes of the scan that are referenced by the expression, returns false if the expression
+//! references anything else
+static bool GatherScanColumns(Expression &expr, idx_t table_index, map<idx_t, idx_t> &columns) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (colref.binding.table_index != table_index || colref.depth > 0) {
+			return false;
+		}
+		columns[colref.binding.column_index] = DConstants::INVALID_INDEX;
+		return true;
+	}
+	bool success = true;
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { success = success && GatherScanColumns(child, table_index, columns); });
+	return success;
+}
+
+static void ReplaceScanColumns(Expression &expr, idx_t old_index, idx_t new_index, const map<idx_t, idx_t> &columns) {
+	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		D_ASSERT(colref.binding.table_index == old_index);
+		colref.binding = ColumnBinding(new_index, columns.find(colref.binding.column_index)->second);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { ReplaceScanColumns(child, old_index, new_index, columns); });
+}
+
+bool LateMaterialization::TryLateMaterialization(unique_ptr<LogicalOperator> &op) {
+	auto &top_n = op->Cast<LogicalTopN>();
+	if (top_n.limit > MAX_ROW_COUNT || top_n.offset > MAX_ROW_COUNT - top_n.limit) {
+		// fetching many rows by row id is slower than scanning the columns
+		return false;
+	}
+	// match TOP_N -> [PROJECTION] -> [FILTER] -> GET
+	optional_ptr<LogicalProjection> projection;
+	reference<LogicalOperator> child = *top_n.children[0];
+	if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projection = &child.get().Cast<LogicalProjection>();
+		for (auto &expr : projection->expressions) {
+			if (expr->IsVolatile()) {
+				// the projection is moved above the Top-N, and inlined into the orders: it can not be volatile
+				return false;
+			}
+		}
+		child = *child.get().children[0];
+	}
+	optional_ptr<LogicalFilter> filter;
+	if (child.get().type == LogicalOperatorType::LOGICAL_FILTER) {
+		filter = &child.get().Cast<LogicalFilter>();
+		if (!filter->projection_map.empty()) {
+			return false;
+		}
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.children.empty()) {
+		return false;
+	}
+	auto table = get.GetTable();
+	if (!table || !table->IsDuckTable()) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan) {
+		return false;
+	}
+
+	// figure out which columns are required to compute the Top-N
+	vector<unique_ptr<Expression>> orders;
+	for (auto &order : top_n.orders) {
+		auto expr = order.expression->Copy();
+		if (projection) {
+			InlineProjection(*projection, expr);
+		}
+		orders.push_back(std::move(expr));
+	}
+	map<idx_t, idx_t> early_columns;
+	for (auto &expr : orders) {
+		if (!GatherScanColumns(*expr, get.table_index, early_columns)) {
+			return false;
+		}
+	}
+	if (filter) {
+		for (auto &expr : filter->expressions) {
+			if (!GatherScanColumns(*expr, get.table_index, early_columns)) {
+				return false;
+			}
+		}
+	}
+	// only rewrite if there are projected columns that are not required for the Top-N
+	idx_t projected_count = get.projection_ids.empty() ? get.column_ids.size() : get.projection_ids.size();
+	idx_t deferred_count = 0;
+	for (idx_t i = 0; i < projected_count; i++) {
+		auto column_index = get.projection_ids.empty() ? i : get.projection_ids[i];
+		if (early_columns.find(column_index) == early_columns.end()) {
+			deferred_count++;
+		}
+	}
+	if (deferred_count == 0) {
+		return false;
+	}
+
+	// the narrow scan reads the early columns, the columns with table filters and the row ids
+	vector<column_t> scan_column_ids;
+	for (auto &entry : early_columns) {
+		auto column_id = get.column_ids[entry.first];
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			return false;
+		}
+		entry.second = scan_column_ids.size();
+		scan_column_ids.push_back(column_id);
+	}
+	for (auto &entry : get.table_filters.filters) {
+		if (std::find(scan_column_ids.begin(), scan_column_ids.end(), entry.first) == scan_column_ids.end()) {
+			scan_column_ids.push_back(entry.first);
+		}
+	}
+	scan_column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+
+	auto scan_index = optimizer.binder.GenerateTableIndex();
+	auto scan = make_uniq<LogicalGet>(scan_index, get.function, std::move(get.bind_data), get.returned_types, get.names);
+	scan->column_ids = std::move(scan_column_ids);
+	scan->table_filters = std::move(get.table_filters);
+	scan->parameters = get.parameters;
+	scan->named_parameters = get.named_parameters;
+	scan->extra_info = get.extra_info;
+	scan->estimated_cardinality = get.estimated_cardinality;
+	scan->has_estimated_cardinality = get.has_estimated_cardinality;
+
+	// the fetch takes the place of the original scan: it emits the same columns under the same bindings
+	auto fetch = make_uniq<LogicalGet>(get.table_index, TableScanFunction::GetRowIdFetchFunction(),
+	                                   make_uniq<TableScanBindData>(table->Cast<DuckTableEntry>()), get.returned_types,
+	                                   get.names);
+	fetch->column_ids = get.column_ids;
+	fetch->projection_ids = get.projection_ids;
+	fetch->estimated_cardinality = top_n.estimated_cardinality;
+	fetch->has_estimated_cardinality = top_n.has_estimated_cardinality;
+
+	// rewrite the Top-N (and the filter) to operate on the narrow scan
+	for (idx_t i = 0; i < orders.size(); i++) {
+		ReplaceScanColumns(*orders[i], get.table_index, scan_index, early_columns);
+		top_n.orders[i].expression = std::move(orders[i]);
+	}
+	unique_ptr<LogicalOperator> narrow_plan = std::move(scan);
+	if (filter) {
+		for (auto &expr : filter->expressions) {
+			ReplaceScanColumns(*expr, get.table_index, scan_index, early_columns);
+		}
+		auto filter_op = projection ? std::move(projection->children[0]) : std::move(top_n.children[0]);
+		filter_op->children[0] = std::move(narrow_plan);
+		narrow_plan = std::move(filter_op);
+	}
+	unique_ptr<LogicalOperator> projection_op;
+	if (projection) {
+		projection_op = std::move(top_n.children[0]);
+	}
+	top_n.children[0] = std::move(narrow_plan);
+
+	// TOP_N -> [PROJECTION] -> [FILTER] -> GET becomes [PROJECTION] -> FETCH -> TOP_N -> [FILTER] -> NARROW GET
+	fetch->children.push_back(std::move(op));
+	if (projection_op) {
+		projection_op->children[0] = std::move(fetch);
+		op = std::move(projection_op);
+	} else {
+		op = std::move(fetch);
+	}
+	op->ResolveOperatorTypes();
+	return true;
+}
+
+unique_ptr<LogicalOperator> LateMaterialization::Optimize(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_TOP_N) {
+		TryLateMaterialization(op);
+	}
+	return op;
+}
+
+} // namespace duckdb
@@ -11,8 +11,11 @@
 #include "duckdb/optimizer/expression_heuristics.hpp"
 #include "duckdb/optimizer/filter_pullup.hpp"
 #include "duckdb/optimizer/filter_pushdown.hpp"
+#include "duckdb/optimizer/grouping_sets_rewriter.hpp"
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
+#include "duckdb/optimizer/late_materialization.hpp"
+#include "duckdb/optimizer/quantile_sort_rewriter.hpp"
 #include "duckdb/optimizer/regex_range_filter.hpp"
 #include "duckdb/optimizer/remove_duplicate_groups.hpp"
 #include "duckdb/optimizer/remove_unused_columns.hpp"
@@ -136,6 +139,18 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		plan = unnest_rewriter.Optimize(std::move(plan));
 	});
 
+	// computes exact quantiles over large inputs by sorting instead of in the hash table
+	RunOptimizer(OptimizerType::QUANTILE_SORT, [&]() {
+		QuantileSortRewriter quantile_sort(*this);
+		plan = quantile_sort.Optimize(std::move(plan));
+	});
+
+	// computes the grouping sets of decomposable aggregates from an aggregate over all groups
+	RunOptimizer(OptimizerType::GROUPING_SETS, [&]() {
+		GroupingSetsRewriter grouping_sets(*this);
+		plan = grouping_sets.Optimize(std::move(plan));
+	});
+
 	// removes unused columns
 	RunOptimizer(OptimizerType::UNUSED_COLUMNS, [&]() {
 		RemoveUnusedColumns unused(binder, context, true);
@@ -160,6 +175,12 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 		plan = topn.Optimize(std::move(plan));
 	});
 
+	// defer reading the columns that are only projected by a Top-N until after the Top-N is computed
+	RunOptimizer(OptimizerType::LATE_MATERIALIZATION, [&]() {
+		LateMaterialization late_materialization(*this);
+		plan = late_materialization.Optimize(std::move(plan));
+	});
+
 	// creates projection maps so unused columns are projected out early
 	RunOptimizer(OptimizerType::COLUMN_LIFETIME, [&]() {
 		ColumnLifetimeAnalyzer column_lifetime(true);
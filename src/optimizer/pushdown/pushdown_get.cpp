@@ -54,6 +54,10 @@ unique_ptr<LogicalOperator> FilterPushdown::PushdownGet(unique_ptr<LogicalOperat
 	//! We generate the table filters that will be executed during the table scan
 	//! Right now this only executes simple AND filters
 	get.table_filters = combiner.GenerateTableScanFilters(get.column_ids);
+	if (get.GetTable()) {
+		// filters on paths of JSON columns can prune row groups using the statistics of the shredded paths
+		combiner.GenerateJSONPathFilters(get.column_ids, get.table_filters);
+	}
 
 	// //! For more complex filters if all filters to a column are constants we generate a min max boundary used to
 	// check
@@ -0,0 +1,261 @@
+#include "duckdb/optimizer/quantile_sort_rewriter.hpp"
+
+#include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
+#include "duckdb/core_functions/aggregate/quantile_helpers.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_case_expression.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_window.hpp"
+
+namespace duckdb {
+
+QuantileSortRewriter::QuantileSortRewriter(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<Expression> QuantileSortRewriter::BindScalarFunction(const string &name,
+                                                                vector<unique_ptr<Expression>> children) {
+	FunctionBinder binder(optimizer.context);
+	ErrorData error;
+	auto result = binder.BindScalarFunction(DEFAULT_SCHEMA, name, std::move(children), error);
+	if (!result) {
+		error.Throw();
+	}
+	return result;
+}
+
+unique_ptr<Expression> QuantileSortRewriter::BindAggregateFunction(const string &name,
+                                                                   vector<unique_ptr<Expression>> children,
+                                                                   unique_ptr<Expression> filter) {
+	QueryErrorContext error_context;
+	auto &func = Catalog::GetEntry<AggregateFunctionCatalogEntry>(optimizer.context, SYSTEM_CATALOG, DEFAULT_SCHEMA,
+	                                                              name, error_context);
+	vector<LogicalType> types;
+	for (const auto &child : children) {
+		types.emplace_back(child->return_type);
+	}
+	FunctionBinder binder(optimizer.context);
+	ErrorData error;
+	auto best_function = binder.BindFunction(func.name, func.functions, types, error);
+	if (!best_function.IsValid()) {
+		error.Throw();
+	}
+	auto bound_function = func.functions.GetFunctionByOffset(best_function.GetIndex());
+	return binder.BindAggregateFunction(bound_function, std::move(children), std::move(filter));
+}
+
+bool QuantileSortRewriter::CanRewrite(BoundAggregateExpression &aggr, bool &discrete) {
+	const auto &name = aggr.function.name;
+	if (name != "median" && name != "quantile" && name != "quantile_disc" && name != "quantile_cont") {
+		return false;
+	}
+	if (aggr.IsDistinct() || aggr.filter || aggr.order_bys || aggr.children.size() != 1 || !aggr.bind_info) {
+		return false;
+	}
+	auto &bind_data = aggr.bind_info->Cast<QuantileBindData>();
+	if (bind_data.quantiles.size() != 1 || bind_data.desc || aggr.return_type.id() == LogicalTypeId::LIST) {
+		return false;
+	}
+	auto &quantile = bind_data.quantiles[0];
+	if (quantile.val.type().id() == LogicalTypeId::DECIMAL && quantile.dbl != 0.5) {
+		// the position of a DECIMAL quantile is computed with integer arithmetic (only used by the median)
+		return false;
+	}
+	auto &input_type = aggr.children[0]->return_type;
+	if (name == "quantile" || name == "quantile_disc") {
+		discrete = true;
+		return true;
+	}
+	const auto input_id = input_type.id();
+	if (name == "median" && (input_id == LogicalTypeId::VARCHAR || input_id == LogicalTypeId::INTERVAL)) {
+		// the median of a type that can not be interpolated
+		discrete = true;
+		return true;
+	}
+	// interpolating quantiles are only rewritten if they interpolate as DOUBLE
+	if (aggr.return_type.id() != LogicalTypeId::DOUBLE) {
+		return false;
+	}
+	switch (input_id) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::DOUBLE:
+		discrete = false;
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool QuantileSortRewriter::TryRewrite(LogicalAggregate &aggr) {
+	if (aggr.grouping_sets.size() > 1 || !aggr.grouping_functions.empty()) {
+		return false;
+	}
+	auto &context = optimizer.context;
+	auto &child = *aggr.children[0];
+	const auto cardinality =
+	    child.has_estimated_cardinality ? child.estimated_cardinality : child.EstimateCardinality(context);
+	if (cardinality < ClientConfig::GetConfig(context).quantile_sort_threshold) {
+		return false;
+	}
+
+	// for every argument of a quantile: number the rows of a group by the argument, and count the (non-NULL) values
+	auto window_index = optimizer.binder.GenerateTableIndex();
+	auto window = make_uniq<LogicalWindow>(window_index);
+	vector<unique_ptr<Expression>> arguments;
+	for (auto &expr : aggr.expressions) {
+		auto &aggr_expr = expr->Cast<BoundAggregateExpression>();
+		bool discrete;
+		if (!CanRewrite(aggr_expr, discrete)) {
+			continue;
+		}
+		auto &argument = *aggr_expr.children[0];
+		idx_t argument_idx;
+		for (argument_idx = 0; argument_idx < arguments.size(); argument_idx++) {
+			if (arguments[argument_idx]->Equals(argument)) {
+				break;
+			}
+		}
+		if (argument_idx == arguments.size()) {
+			arguments.push_back(argument.Copy());
+
+			auto row_number = make_uniq<BoundWindowExpression>(ExpressionType::WINDOW_ROW_NUMBER,
+			                                                   LogicalType::BIGINT, nullptr, nullptr);
+			row_number->start = WindowBoundary::UNBOUNDED_PRECEDING;
+			row_number->end = WindowBoundary::CURRENT_ROW_RANGE;
+			row_number->orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, argument.Copy());
+
+			vector<unique_ptr<Expression>> count_children;
+			count_children.push_back(argument.Copy());
+			auto count = BindAggregateFunction("count", std::move(count_children), nullptr);
+			auto &count_aggr = count->Cast<BoundAggregateExpression>();
+			auto count_window =
+			    make_uniq<BoundWindowExpression>(ExpressionType::WINDOW_AGGREGATE, LogicalType::BIGINT,
+			                                     make_uniq<AggregateFunction>(count_aggr.function),
+			                                     std::move(count_aggr.bind_info));
+			count_window->children = std::move(count_aggr.children);
+			count_window->start = WindowBoundary::UNBOUNDED_PRECEDING;
+			count_window->end = WindowBoundary::UNBOUNDED_FOLLOWING;
+
+			for (auto &group : aggr.groups) {
+				row_number->partitions.push_back(group->Copy());
+				count_window->partitions.push_back(group->Copy());
+			}
+			window->expressions.push_back(std::move(row_number));
+			window->expressions.push_back(std::move(count_window));
+		}
+	}
+	if (arguments.empty()) {
+		return false;
+	}
+
+	// replace the quantiles with aggregates over the rows at the position(s) of the quantile
+	for (auto &expr : aggr.expressions) {
+		auto &aggr_expr = expr->Cast<BoundAggregateExpression>();
+		bool discrete;
+		if (!CanRewrite(aggr_expr, discrete)) {
+			continue;
+		}
+		idx_t argument_idx = 0;
+		while (!arguments[argument_idx]->Equals(*aggr_expr.children[0])) {
+			argument_idx++;
+		}
+		const auto quantile = aggr_expr.bind_info->Cast<QuantileBindData>().quantiles[0].dbl;
+		auto row_number = [&]() -> unique_ptr<Expression> {
+			auto colref =
+			    make_uniq<BoundColumnRefExpression>(LogicalType::BIGINT, ColumnBinding(window_index, 2 * argument_idx));
+			return BoundCastExpression::AddCastToType(context, std::move(colref), LogicalType::DOUBLE);
+		};
+		auto count = [&]() -> unique_ptr<Expression> {
+			auto colref = make_uniq<BoundColumnRefExpression>(LogicalType::BIGINT,
+			                                                  ColumnBinding(window_index, 2 * argument_idx + 1));
+			return BoundCastExpression::AddCastToType(context, std::move(colref), LogicalType::DOUBLE);
+		};
+		auto constant = [](double value) -> unique_ptr<Expression> {
+			return make_uniq<BoundConstantExpression>(Value::DOUBLE(value));
+		};
+		auto binary = [&](const string &name, unique_ptr<Expression> lhs, unique_ptr<Expression> rhs) {
+			vector<unique_ptr<Expression>> children;
+			children.push_back(std::move(lhs));
+			children.push_back(std::move(rhs));
+			return BindScalarFunction(name, std::move(children));
+		};
+		auto unary = [&](const string &name, unique_ptr<Expression> input) {
+			vector<unique_ptr<Expression>> children;
+			children.push_back(std::move(input));
+			return BindScalarFunction(name, std::move(children));
+		};
+
+		// the positions are computed exactly like the Interpolator of the quantile computes them
+		vector<unique_ptr<Expression>> children;
+		unique_ptr<Expression> filter;
+		string function_name;
+		if (discrete) {
+			// row_number = max(1, n - floor(n - n * q))
+			auto floored = unary("floor", binary("-", count(), binary("*", count(), constant(quantile))));
+			auto position = binary("greatest", constant(1), binary("-", count(), std::move(floored)));
+			filter =
+			    make_uniq<BoundComparisonExpression>(ExpressionType::COMPARE_EQUAL, row_number(), std::move(position));
+			children.push_back(std::move(aggr_expr.children[0]));
+			function_name = "min";
+		} else {
+			// interpolate between the rows at floor(RN) and ceil(RN), with RN = (n - 1) * q
+			auto rn = [&]() {
+				return binary("*", binary("-", count(), constant(1)), constant(quantile));
+			};
+			auto position = [&]() {
+				return binary("-", row_number(), constant(1));
+			};
+			auto lower = make_uniq<BoundComparisonExpression>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, position(),
+			                                                  unary("floor", rn()));
+			auto upper = make_uniq<BoundComparisonExpression>(ExpressionType::COMPARE_LESSTHANOREQUALTO, position(),
+			                                                  unary("ceil", rn()));
+			filter = make_uniq<BoundConjunctionExpression>(ExpressionType::CONJUNCTION_AND, std::move(lower),
+			                                               std::move(upper));
+
+			// lo * (1 - d) + hi * d, with d = RN - floor(RN)
+			auto delta = [&]() {
+				return binary("-", rn(), unary("floor", rn()));
+			};
+			auto is_lower = make_uniq<BoundComparisonExpression>(ExpressionType::COMPARE_EQUAL, position(),
+			                                                     unary("floor", rn()));
+			auto weight = make_uniq<BoundCaseExpression>(std::move(is_lower), binary("-", constant(1), delta()),
+			                                             delta());
+			auto value = BoundCastExpression::AddCastToType(context, std::move(aggr_expr.children[0]),
+			                                                LogicalType::DOUBLE);
+			children.push_back(binary("*", std::move(value), std::move(weight)));
+			function_name = "sum";
+		}
+		auto alias = std::move(aggr_expr.alias);
+		expr = BindAggregateFunction(function_name, std::move(children), std::move(filter));
+		expr->alias = std::move(alias);
+	}
+
+	window->children.push_back(std::move(aggr.children[0]));
+	window->ResolveOperatorTypes();
+	aggr.children[0] = std::move(window);
+	return true;
+}
+
+unique_ptr<LogicalOperator> QuantileSortRewriter::Optimize(unique_ptr<LogicalOperator> op) {
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY) {
+		TryRewrite(op->Cast<LogicalAggregate>());
+	}
+	return op;
+}
+
+} // namespace duckdb
@@ -32,6 +32,11 @@ void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &input, TableFi
 
 unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalGet &get,
                                                                      unique_ptr<LogicalOperator> &node_ptr) {
+	for (auto &child : get.children) {
+		// table in-out function: propagate statistics through its input
+		PropagateStatistics(child);
+		node_stats = nullptr;
+	}
 	if (get.function.cardinality) {
 		node_stats = get.function.cardinality(context, get.bind_data.get());
 	}
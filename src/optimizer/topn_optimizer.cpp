@@ -1,8 +1,12 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -25,6 +29,78 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	case PhysicalType::VARCHAR:
+		return type.id() == LogicalTypeId::VARCHAR;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	auto &order = op.orders[0];
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values sort before the boundary, but do not pass the filter
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return;
+	}
+	if (!SupportsDynamicFilter(order.expression->return_type)) {
+		return;
+	}
+	// follow the order column through projections and filters down to the scan
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+			auto &projection = child.get().Cast<LogicalProjection>();
+			if (binding.table_index != projection.table_index) {
+				return;
+			}
+			auto &expr = projection.expressions[binding.column_index];
+			if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr->Cast<BoundColumnRefExpression>().binding;
+		} else if (child.get().type != LogicalOperatorType::LOGICAL_FILTER) {
+			return;
+		}
+		child = *child.get().children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.function.dynamic_filter_pushdown || binding.table_index != get.table_index || !get.children.empty()) {
+		return;
+	}
+	auto column_id = get.column_ids[binding.column_index];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	// rows that compare equal to the boundary on the first column can still qualify through the other columns
+	bool is_last = op.orders.size() == 1;
+	ExpressionType comparison_type;
+	if (order.type == OrderType::ASCENDING) {
+		comparison_type = is_last ? ExpressionType::COMPARE_LESSTHAN : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	} else {
+		comparison_type = is_last ? ExpressionType::COMPARE_GREATERTHAN : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	}
+	op.dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type, order.expression->return_type);
+	get.table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(op.dynamic_filter));
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 		auto &limit = op->Cast<LogicalLimit>();
@@ -36,6 +112,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 	} else {
 		for (auto &child : op->children) {
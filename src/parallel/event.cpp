@@ -3,6 +3,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/executor.hpp"
+#include "duckdb/main/query_tracer.hpp"
 
 namespace duckdb {
 
@@ -17,6 +18,7 @@ void Event::CompleteDependency() {
 	if (current_finished == total_dependencies) {
 		// all dependencies have been completed: schedule the event
 		D_ASSERT(total_tasks == 0);
+		TraceSpan span("executor", "schedule event");
 		Schedule();
 		if (total_tasks == 0) {
 			Finish();
@@ -26,6 +28,7 @@ void Event::CompleteDependency() {
 
 void Event::Finish() {
 	D_ASSERT(!finished);
+	TraceSpan span("executor", "finish event");
 	FinishEvent();
 	finished = true;
 	// finished processing the pipeline, now we can schedule pipelines that depend on this pipeline
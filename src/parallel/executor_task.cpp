@@ -1,6 +1,7 @@
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_tracer.hpp"
 
 namespace duckdb {
 
@@ -28,8 +29,14 @@ void ExecutorTask::Reschedule() {
 }
 
 TaskExecutionResult ExecutorTask::Execute(TaskExecutionMode mode) {
+	QueryTracerScope tracer_scope(executor.context);
 	try {
-		return ExecuteTask(mode);
+		TraceSpan span("executor", "task");
+		auto result = ExecuteTask(mode);
+		if (result == TaskExecutionResult::TASK_BLOCKED) {
+			QueryTracer::AddInstantEvent("executor", "task blocked");
+		}
+		return result;
 	} catch (std::exception &ex) {
 		executor.PushError(ErrorData(ex));
 	} catch (...) { // LCOV_EXCL_START
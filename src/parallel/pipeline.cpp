@@ -2,6 +2,7 @@
 
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/common/tree_renderer.hpp"
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
@@ -9,6 +10,7 @@
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/query_tracer.hpp"
 #include "duckdb/parallel/pipeline_event.hpp"
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -36,6 +38,15 @@ TaskExecutionResult PipelineTask::ExecuteTask(TaskExecutionMode mode) {
 
 	pipeline_executor->SetTaskForInterrupts(shared_from_this());
 
+	TraceSpan span("pipeline", "pipeline");
+	if (QueryTracer::IsActive()) {
+		for (auto &op : pipeline.GetOperators()) {
+			auto name = op.get().GetName();
+			StringUtil::Trim(name);
+			span.detail += (span.detail.empty() ? "" : " -> ") + name;
+		}
+	}
+
 	if (mode == TaskExecutionMode::PROCESS_PARTIAL) {
 		auto res = pipeline_executor->Execute(PARTIAL_CHUNK_COUNT);
 
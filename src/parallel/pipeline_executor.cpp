@@ -1,5 +1,6 @@
 #include "duckdb/parallel/pipeline_executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/query_tracer.hpp"
 #include "duckdb/common/limits.hpp"
 
 #ifdef DUCKDB_DEBUG_ASYNC_SINK_SOURCE
@@ -9,6 +10,13 @@
 
 namespace duckdb {
 
+//! Records that the pipeline was interrupted by the operator in the trace of the query
+static void TraceInterrupt(const char *name, const PhysicalOperator &op) {
+	if (QueryTracer::IsActive()) {
+		QueryTracer::AddInstantEvent("pipeline", name, op.GetName());
+	}
+}
+
 PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_p)
     : pipeline(pipeline_p), thread(context_p), context(context_p, thread, &pipeline_p) {
 	D_ASSERT(pipeline.source_state);
@@ -155,6 +163,7 @@ SinkNextBatchType PipelineExecutor::NextBatch(duckdb::DataChunk &source_chunk) {
 	auto next_batch_result = pipeline.sink->NextBatch(context, next_batch_input);
 
 	if (next_batch_result == SinkNextBatchType::BLOCKED) {
+		TraceInterrupt("next batch blocked", *pipeline.sink);
 		partition_info.batch_index = current_batch; // set batch_index back to what it was before
 		return SinkNextBatchType::BLOCKED;
 	}
@@ -299,6 +308,7 @@ OperatorResultType PipelineExecutor::ExecutePushInternal(DataChunk &input, idx_t
 			EndOperator(*pipeline.sink, nullptr);
 
 			if (sink_result == SinkResultType::BLOCKED) {
+				TraceInterrupt("sink blocked", *pipeline.sink);
 				return OperatorResultType::BLOCKED;
 			} else if (sink_result == SinkResultType::FINISHED) {
 				FinishProcessing();
@@ -335,9 +345,16 @@ PipelineExecuteResult PipelineExecutor::PushFinalize() {
 		return PipelineExecuteResult::INTERRUPTED;
 	}
 #endif
-	auto result = pipeline.sink->Combine(context, combine_input);
+	SinkCombineResultType result;
+	{
+		TraceSpan span("pipeline", "combine");
+		StartOperator(*pipeline.sink);
+		result = pipeline.sink->Combine(context, combine_input);
+		EndOperator(*pipeline.sink, nullptr);
+	}
 
 	if (result == SinkCombineResultType::BLOCKED) {
+		TraceInterrupt("combine blocked", *pipeline.sink);
 		return PipelineExecuteResult::INTERRUPTED;
 	}
 
@@ -493,6 +510,9 @@ SourceResultType PipelineExecutor::FetchFromSource(DataChunk &result) {
 
 	// Ensures Sinks only return empty results when Blocking or Finished
 	D_ASSERT(res != SourceResultType::BLOCKED || result.size() == 0);
+	if (res == SourceResultType::BLOCKED) {
+		TraceInterrupt("source blocked", *pipeline.source);
+	}
 
 	EndOperator(*pipeline.source, &result);
 
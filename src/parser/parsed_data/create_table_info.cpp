@@ -2,6 +2,8 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/common/string_util.hpp"
 
 namespace duckdb {
 
@@ -26,6 +28,12 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->row_group_size = row_group_size;
+	for (auto &order : order_by) {
+		result->order_by.emplace_back(order.type, order.null_order, order.expression->Copy());
+	}
+	result->order_by_option = order_by_option;
+	result->cluster_by_option = cluster_by_option;
 	return std::move(result);
 }
 
@@ -46,10 +54,33 @@ string CreateTableInfo::ToString() const {
 	}
 	ret += QualifierToString(temporary ? "" : catalog, schema, table);
 
+	vector<string> table_options;
+	if (row_group_size.IsValid()) {
+		table_options.push_back("row_group_size = " + to_string(row_group_size.GetIndex()));
+	}
+	if (!order_by_option.empty()) {
+		table_options.push_back("order_by = " + KeywordHelper::WriteQuoted(order_by_option, '\''));
+	} else if (!order_by.empty()) {
+		string order_list;
+		for (auto &order : order_by) {
+			if (!order_list.empty()) {
+				order_list += ", ";
+			}
+			order_list += order.ToString();
+		}
+		table_options.push_back("order_by = " + KeywordHelper::WriteQuoted(order_list, '\''));
+	}
+	if (!cluster_by_option.empty()) {
+		table_options.push_back("cluster_by = " + KeywordHelper::WriteQuoted(cluster_by_option, '\''));
+	}
+	string options;
+	if (!table_options.empty()) {
+		options = " WITH (" + StringUtil::Join(table_options, ", ") + ")";
+	}
 	if (query != nullptr) {
-		ret += " AS " + query->ToString();
+		ret += options + " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + options + ";";
 	}
 	return ret;
 }
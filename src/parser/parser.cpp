@@ -385,6 +385,15 @@ vector<OrderByNode> Parser::ParseOrderList(const string &select_list, ParserOpti
 	return std::move(order.orders);
 }
 
+unique_ptr<QueryNode> Parser::ParseClusterBy(const string &cluster_list, unique_ptr<QueryNode> node,
+                                             ParserOptions options) {
+	auto cluster_by = ParseExpressionList(cluster_list, options);
+	if (cluster_by.empty()) {
+		throw ParserException("Table option \"cluster_by\" requires at least one expression");
+	}
+	return Transformer::TransformClusterBy(std::move(node), std::move(cluster_by));
+}
+
 void Parser::ParseUpdateList(const string &update_list, vector<string> &update_columns,
                              vector<unique_ptr<ParsedExpression>> &expressions, ParserOptions options) {
 	// construct a mock query
@@ -2,6 +2,12 @@
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/parser/transformer.hpp"
 #include "duckdb/parser/expression/star_expression.hpp"
+#include "duckdb/parser/expression/cast_expression.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/window_expression.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/tableref/subqueryref.hpp"
 
 namespace duckdb {
 
@@ -44,4 +50,53 @@ bool Transformer::TransformOrderBy(duckdb_libpgquery::PGList *order, vector<Orde
 	return true;
 }
 
+static unique_ptr<SelectStatement> WrapInStatement(unique_ptr<QueryNode> node) {
+	auto statement = make_uniq<SelectStatement>();
+	statement->node = std::move(node);
+	return statement;
+}
+
+unique_ptr<QueryNode> Transformer::TransformClusterBy(unique_ptr<QueryNode> node,
+                                                      vector<unique_ptr<ParsedExpression>> cluster_by) {
+	static constexpr const char *CLUSTER_KEY_NAME = "__duckdb_cluster_key";
+	D_ASSERT(!cluster_by.empty());
+	// every clustered expression is replaced by its rank, scaled to a 32-bit integer
+	// this gives every expression the same weight in the Z-order key regardless of its type or value range
+	vector<unique_ptr<ParsedExpression>> key_inputs;
+	for (auto &expr : cluster_by) {
+		auto rank = make_uniq<WindowExpression>(ExpressionType::WINDOW_PERCENT_RANK, INVALID_CATALOG, INVALID_SCHEMA,
+		                                        "percent_rank");
+		rank->start = WindowBoundary::UNBOUNDED_PRECEDING;
+		rank->end = WindowBoundary::CURRENT_ROW_RANGE;
+		rank->orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST, std::move(expr));
+		auto scale = make_uniq<ConstantExpression>(Value::DOUBLE(double(NumericLimits<uint32_t>::Maximum())));
+		vector<unique_ptr<ParsedExpression>> children;
+		children.push_back(std::move(rank));
+		children.push_back(std::move(scale));
+		auto scaled_rank = make_uniq<FunctionExpression>("*", std::move(children));
+		scaled_rank->is_operator = true;
+		key_inputs.push_back(make_uniq<CastExpression>(LogicalType::UBIGINT, std::move(scaled_rank)));
+	}
+	auto cluster_key = make_uniq<FunctionExpression>("zorder_key", std::move(key_inputs));
+	cluster_key->alias = CLUSTER_KEY_NAME;
+
+	// SELECT *, zorder_key(...) AS cluster_key FROM (node)
+	auto key_node = make_uniq<SelectNode>();
+	key_node->select_list.push_back(make_uniq<StarExpression>());
+	key_node->select_list.push_back(std::move(cluster_key));
+	key_node->from_table = make_uniq<SubqueryRef>(WrapInStatement(std::move(node)));
+
+	// SELECT * EXCLUDE (cluster_key) FROM (...) ORDER BY cluster_key
+	auto result = make_uniq<SelectNode>();
+	auto star = make_uniq<StarExpression>();
+	star->exclude_list.insert(CLUSTER_KEY_NAME);
+	result->select_list.push_back(std::move(star));
+	result->from_table = make_uniq<SubqueryRef>(WrapInStatement(std::move(key_node)));
+	auto order = make_uniq<OrderModifier>();
+	order->orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+	                           make_uniq<ColumnRefExpression>(CLUSTER_KEY_NAME));
+	result->modifiers.push_back(std::move(order));
+	return std::move(result);
+}
+
 } // namespace duckdb
@@ -2,8 +2,11 @@
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/core_functions/scalar/struct_functions.hpp"
 #include "duckdb/function/replacement_scan.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
 #include "duckdb/parser/statement/copy_statement.hpp"
 #include "duckdb/parser/tableref/basetableref.hpp"
 #include "duckdb/parser/transformer.hpp"
@@ -125,6 +128,40 @@ unique_ptr<CopyStatement> Transformer::TransformCopy(duckdb_libpgquery::PGCopySt
 	// handle the different options of the COPY statement
 	TransformCopyOptions(info, stmt.options);
 
+	auto cluster_entry = info.options.find("cluster_by");
+	if (cluster_entry != info.options.end()) {
+		// CLUSTER_BY (a, b): write the rows ordered on a Z-order curve over the given columns
+		if (info.is_from) {
+			throw ParserException("CLUSTER_BY is only supported for COPY ... TO");
+		}
+		vector<unique_ptr<ParsedExpression>> cluster_by;
+		for (auto &column : cluster_entry->second) {
+			cluster_by.push_back(make_uniq<ColumnRefExpression>(column.ToString()));
+		}
+		info.options.erase(cluster_entry);
+		if (cluster_by.empty()) {
+			throw ParserException("CLUSTER_BY requires at least one column");
+		}
+		if (!info.select_statement) {
+			// copy table into file: generate SELECT * FROM table
+			auto table_ref = make_uniq<BaseTableRef>();
+			table_ref->catalog_name = info.catalog;
+			table_ref->schema_name = info.schema;
+			table_ref->table_name = info.table;
+
+			auto select_node = make_uniq<SelectNode>();
+			select_node->from_table = std::move(table_ref);
+			for (auto &name : info.select_list) {
+				select_node->select_list.push_back(make_uniq<ColumnRefExpression>(name));
+			}
+			if (select_node->select_list.empty()) {
+				select_node->select_list.push_back(make_uniq<StarExpression>());
+			}
+			info.select_statement = std::move(select_node);
+		}
+		info.select_statement = TransformClusterBy(std::move(info.select_statement), std::move(cluster_by));
+	}
+
 	return result;
 }
 
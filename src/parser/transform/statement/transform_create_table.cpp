@@ -3,7 +3,9 @@
 #include "duckdb/parser/transformer.hpp"
 #include "duckdb/parser/constraint.hpp"
 #include "duckdb/parser/expression/collate_expression.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
+#include "duckdb/common/string_util.hpp"
 
 namespace duckdb {
 
@@ -66,6 +68,52 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+void Transformer::TransformTableOptions(CreateTableInfo &info, optional_ptr<duckdb_libpgquery::PGList> table_options) {
+	if (!table_options) {
+		return;
+	}
+	duckdb_libpgquery::PGListCell *cell;
+	for_each_cell(cell, table_options->head) {
+		auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+		auto option_name = StringUtil::Lower(def_elem->defname);
+		if (option_name == "row_group_size") {
+			if (!def_elem->arg || def_elem->arg->type != duckdb_libpgquery::T_PGInteger) {
+				throw ParserException("Table option \"row_group_size\" requires an integer value");
+			}
+			auto val = TransformValue(*PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg))->value;
+			if (val.GetValue<int64_t>() <= 0) {
+				throw ParserException("Table option \"row_group_size\" must be a positive integer");
+			}
+			info.row_group_size = val.GetValue<idx_t>();
+		} else if (option_name == "order_by") {
+			if (!def_elem->arg || def_elem->arg->type != duckdb_libpgquery::T_PGString) {
+				throw ParserException("Table option \"order_by\" requires a string value, e.g. order_by = 'a, b DESC'");
+			}
+			// the order list is parsed when the table is bound, the parser can not be re-entered while transforming
+			info.order_by_option = string(PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg)->val.str);
+			StringUtil::Trim(info.order_by_option);
+			if (info.order_by_option.empty()) {
+				throw ParserException("Table option \"order_by\" requires at least one column");
+			}
+		} else if (option_name == "cluster_by") {
+			if (!info.query) {
+				throw ParserException("Table option \"cluster_by\" is only supported for CREATE TABLE AS");
+			}
+			if (!def_elem->arg || def_elem->arg->type != duckdb_libpgquery::T_PGString) {
+				throw ParserException(
+				    "Table option \"cluster_by\" requires a string value, e.g. cluster_by = 'tenant, ts'");
+			}
+			info.cluster_by_option = string(PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg)->val.str);
+			StringUtil::Trim(info.cluster_by_option);
+			if (info.cluster_by_option.empty()) {
+				throw ParserException("Table option \"cluster_by\" requires at least one expression");
+			}
+		} else {
+			throw ParserException("Unrecognized table option \"%s\"", def_elem->defname);
+		}
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -123,6 +171,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 	if (!column_count) {
 		throw ParserException("Table must have at least one column!");
 	}
+	TransformTableOptions(*info, stmt.options);
 
 	result->info = std::move(info);
 	return result;
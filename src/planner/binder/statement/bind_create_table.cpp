@@ -19,7 +19,10 @@
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/parser/parsed_data/create_index_info.hpp"
+#include "duckdb/parser/parser.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/storage/storage_info.hpp"
+#include "duckdb/main/config.hpp"
 
 #include <algorithm>
 
@@ -308,6 +311,12 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
 	if (base.query) {
+		if (!base.cluster_by_option.empty()) {
+			// like the order_by table option, cluster_by is parsed here rather than in the transformer
+			base.query->node = Parser::ParseClusterBy(base.cluster_by_option, std::move(base.query->node),
+			                                          context.GetParserOptions());
+			base.cluster_by_option.clear();
+		}
 		// construct the result object
 		auto query_obj = Bind(*base.query);
 		base.query.reset();
@@ -343,6 +352,46 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	if (base.columns.PhysicalColumnCount() == 0) {
 		throw BinderException("Creating a table without physical (non-generated) columns is not supported");
 	}
+	if (base.row_group_size.IsValid()) {
+		auto row_group_size = base.row_group_size.GetIndex();
+		if (row_group_size < STANDARD_VECTOR_SIZE || row_group_size > Storage::MAX_ROW_GROUP_SIZE ||
+		    row_group_size % STANDARD_VECTOR_SIZE != 0) {
+			throw BinderException("row_group_size must be a multiple of the vector size (%llu) between %llu and %llu, "
+			                      "but got %llu",
+			                      idx_t(STANDARD_VECTOR_SIZE), idx_t(STANDARD_VECTOR_SIZE), Storage::MAX_ROW_GROUP_SIZE,
+			                      row_group_size);
+		}
+	}
+	if (!base.order_by_option.empty()) {
+		// the order_by table option is parsed here rather than in the transformer, which can not re-enter the parser
+		base.order_by = Parser::ParseOrderList(base.order_by_option, context.GetParserOptions());
+		base.order_by_option.clear();
+		if (base.order_by.empty()) {
+			throw BinderException("Table option \"order_by\" requires at least one column");
+		}
+	}
+	if (!base.order_by.empty()) {
+		// the table is sorted on a set of its physical columns - resolve the default orders so they are persisted
+		auto &config = DBConfig::GetConfig(context);
+		for (auto &order : base.order_by) {
+			if (order.expression->GetExpressionType() != ExpressionType::COLUMN_REF) {
+				throw BinderException("Table option \"order_by\" only supports column references, but got \"%s\"",
+				                      order.expression->ToString());
+			}
+			auto &colref = order.expression->Cast<ColumnRefExpression>();
+			if (colref.IsQualified() || !base.columns.ColumnExists(colref.GetColumnName())) {
+				throw BinderException("Table option \"order_by\" refers to column \"%s\" which does not exist",
+				                      colref.ToString());
+			}
+			auto &column = base.columns.GetColumn(colref.GetColumnName());
+			if (column.Generated()) {
+				throw BinderException("Table option \"order_by\" cannot refer to generated column \"%s\"",
+				                      column.Name());
+			}
+			order.type = config.ResolveOrder(order.type);
+			order.null_order = config.ResolveNullOrder(order.type, order.null_order);
+		}
+	}
 	// bind collations to detect any unsupported collation errors
 	for (idx_t i = 0; i < base.columns.PhysicalColumnCount(); i++) {
 		auto &column = base.columns.GetColumnMutable(PhysicalIndex(i));
@@ -104,6 +104,48 @@ idx_t BoundWindowExpression::GetSharedOrders(const BoundWindowExpression &other)
 	return result;
 }
 
+bool BoundWindowExpression::SortIsPrefixOf(const BoundWindowExpression &other) const {
+	if (partitions.size() < other.partitions.size()) {
+		return false;
+	}
+	// the partitions beyond those of the other window are sorted as the first orders of the other window
+	const auto extra_partitions = partitions.size() - other.partitions.size();
+	if (extra_partitions + orders.size() > other.orders.size()) {
+		return false;
+	}
+	if (extra_partitions == 0) {
+		if (!PartitionsAreEquivalent(other)) {
+			return false;
+		}
+	} else {
+		expression_set_t own_partitions;
+		for (const auto &partition : partitions) {
+			own_partitions.insert(*partition);
+		}
+		expression_set_t sorted_partitions;
+		for (const auto &partition : other.partitions) {
+			sorted_partitions.insert(*partition);
+		}
+		for (idx_t order_idx = 0; order_idx < extra_partitions; ++order_idx) {
+			sorted_partitions.insert(*other.orders[order_idx].expression);
+		}
+		if (own_partitions.size() != partitions.size() || sorted_partitions.size() != partitions.size()) {
+			return false;
+		}
+		for (const auto &partition : sorted_partitions) {
+			if (!own_partitions.count(partition)) {
+				return false;
+			}
+		}
+	}
+	for (idx_t order_idx = 0; order_idx < orders.size(); ++order_idx) {
+		if (!orders[order_idx].Equals(other.orders[extra_partitions + order_idx])) {
+			return false;
+		}
+	}
+	return true;
+}
+
 bool BoundWindowExpression::KeysAreCompatible(const BoundWindowExpression &other) const {
 	if (!PartitionsAreEquivalent(other)) {
 		return false;
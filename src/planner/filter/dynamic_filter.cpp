@@ -0,0 +1,50 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type, const LogicalType &type)
+    : filter(make_uniq<ConstantFilter>(comparison_type, Value(type))) {
+}
+
+void DynamicFilterData::SetValue(Value val) {
+	lock_guard<mutex> l(lock);
+	filter->constant = std::move(val);
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> l(lock);
+	initialized = false;
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> l(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->filter->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+} // namespace duckdb
@@ -0,0 +1,26 @@
+#include "duckdb/planner/filter/json_path_filter.hpp"
+
+namespace duckdb {
+
+JSONPathFilter::JSONPathFilter(string path_p, unique_ptr<TableFilter> child_filter_p)
+    : TableFilter(TableFilterType::JSON_PATH), path(std::move(path_p)), child_filter(std::move(child_filter_p)) {
+}
+
+FilterPropagateResult JSONPathFilter::CheckStatistics(BaseStatistics &stats) {
+	// the statistics of the JSON column say nothing about the values of the path
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string JSONPathFilter::ToString(const string &column_name) {
+	return child_filter->ToString(column_name + "->>'" + path + "'");
+}
+
+bool JSONPathFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<JSONPathFilter>();
+	return other.path == path && other.child_filter->Equals(*child_filter);
+}
+
+} // namespace duckdb
@@ -62,10 +62,12 @@ ArenaAllocator::~ArenaAllocator() {
 data_ptr_t ArenaAllocator::Allocate(idx_t len) {
 	D_ASSERT(!head || head->current_position <= head->maximum_size);
 	if (!head || head->current_position + len > head->maximum_size) {
-		do {
+		if (current_capacity < ARENA_ALLOCATOR_MAX_CAPACITY) {
 			current_capacity *= 2;
-		} while (current_capacity < len);
-		auto new_chunk = make_unsafe_uniq<ArenaChunk>(allocator, current_capacity);
+		}
+		// allocations that are larger than the capacity get a chunk of their own size
+		const auto chunk_size = MaxValue<idx_t>(current_capacity, len);
+		auto new_chunk = make_unsafe_uniq<ArenaChunk>(allocator, chunk_size);
 		if (head) {
 			head->prev = new_chunk.get();
 			new_chunk->next = std::move(head);
@@ -73,7 +75,7 @@ data_ptr_t ArenaAllocator::Allocate(idx_t len) {
 			tail = new_chunk.get();
 		}
 		head = std::move(new_chunk);
-		allocated_size += current_capacity;
+		allocated_size += chunk_size;
 	}
 	D_ASSERT(head->current_position + len <= head->maximum_size);
 	auto result = head->data.get() + head->current_position;
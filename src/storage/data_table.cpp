@@ -31,8 +31,9 @@
 namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
-                             string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+                             string table, idx_t row_group_size)
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      row_group_size(row_group_size) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -45,8 +46,8 @@ bool DataTableInfo::IsTemporary() const {
 
 DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, const string &schema,
                      const string &table, vector<ColumnDefinition> column_definitions_p,
-                     unique_ptr<PersistentTableData> data)
-    : db(db), info(make_shared_ptr<DataTableInfo>(db, std::move(table_io_manager_p), schema, table)),
+                     unique_ptr<PersistentTableData> data, idx_t row_group_size)
+    : db(db), info(make_shared_ptr<DataTableInfo>(db, std::move(table_io_manager_p), schema, table, row_group_size)),
       column_definitions(std::move(column_definitions_p)), is_root(true) {
 	// initialize the table with the existing data from disk, if any
 	auto types = GetTypes();
@@ -109,6 +110,12 @@ DataTable::DataTable(ClientContext &context, DataTable &parent, idx_t removed_co
 		}
 		return false;
 	});
+	// the table cannot be sorted on the removed column either
+	for (auto &sort_key : parent.row_groups->GetSortKeys()) {
+		if (sort_key.column.index == removed_column) {
+			throw CatalogException("Cannot drop this column: the table is sorted on it!");
+		}
+	}
 
 	// erase the column definitions from this DataTable
 	D_ASSERT(removed_column < column_definitions.size());
@@ -216,6 +223,22 @@ TableIOManager &DataTable::GetTableIOManager() {
 	return *info->table_io_manager;
 }
 
+idx_t DataTable::GetRowGroupSize() const {
+	return info->GetRowGroupSize();
+}
+
+const vector<TableSortKey> &DataTable::GetSortKeys() const {
+	return row_groups->GetSortKeys();
+}
+
+void DataTable::SetSortKeys(vector<TableSortKey> sort_keys) {
+	row_groups->SetSortKeys(std::move(sort_keys));
+}
+
+idx_t DataTable::GetGloballySortedKeyCount() {
+	return row_groups->GetGloballySortedKeyCount();
+}
+
 TableIOManager &TableIOManager::Get(DataTable &table) {
 	return table.GetTableIOManager();
 }
@@ -245,7 +268,7 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = Storage::ROW_GROUP_VECTOR_COUNT;
+	idx_t parallel_scan_vector_count = GetRowGroupSize() / STANDARD_VECTOR_SIZE;
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
 		parallel_scan_vector_count = 1;
 	}
@@ -165,6 +165,8 @@ void CreateTableInfo::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty<ColumnList>(201, "columns", columns);
 	serializer.WritePropertyWithDefault<vector<unique_ptr<Constraint>>>(202, "constraints", constraints);
 	serializer.WritePropertyWithDefault<unique_ptr<SelectStatement>>(203, "query", query);
+	serializer.WritePropertyWithDefault<optional_idx>(204, "row_group_size", row_group_size, optional_idx());
+	serializer.WritePropertyWithDefault<vector<OrderByNode>>(205, "order_by", order_by);
 }
 
 unique_ptr<CreateInfo> CreateTableInfo::Deserialize(Deserializer &deserializer) {
@@ -173,6 +175,8 @@ unique_ptr<CreateInfo> CreateTableInfo::Deserialize(Deserializer &deserializer)
 	deserializer.ReadProperty<ColumnList>(201, "columns", result->columns);
 	deserializer.ReadPropertyWithDefault<vector<unique_ptr<Constraint>>>(202, "constraints", result->constraints);
 	deserializer.ReadPropertyWithDefault<unique_ptr<SelectStatement>>(203, "query", result->query);
+	deserializer.ReadPropertyWithDefault<optional_idx>(204, "row_group_size", result->row_group_size, optional_idx());
+	deserializer.ReadPropertyWithDefault<vector<OrderByNode>>(205, "order_by", result->order_by);
 	return std::move(result);
 }
 
@@ -10,6 +10,8 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/json_path_filter.hpp"
 
 namespace duckdb {
 
@@ -30,12 +32,18 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	case TableFilterType::CONSTANT_COMPARISON:
 		result = ConstantFilter::Deserialize(deserializer);
 		break;
+	case TableFilterType::DYNAMIC_FILTER:
+		result = DynamicFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::IS_NOT_NULL:
 		result = IsNotNullFilter::Deserialize(deserializer);
 		break;
 	case TableFilterType::IS_NULL:
 		result = IsNullFilter::Deserialize(deserializer);
 		break;
+	case TableFilterType::JSON_PATH:
+		result = JSONPathFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::STRUCT_EXTRACT:
 		result = StructFilter::Deserialize(deserializer);
 		break;
@@ -80,6 +88,15 @@ unique_ptr<TableFilter> ConstantFilter::Deserialize(Deserializer &deserializer)
 	return std::move(result);
 }
 
+void DynamicFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+}
+
+unique_ptr<TableFilter> DynamicFilter::Deserialize(Deserializer &deserializer) {
+	auto result = duckdb::unique_ptr<DynamicFilter>(new DynamicFilter());
+	return std::move(result);
+}
+
 void IsNotNullFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 }
@@ -98,6 +115,19 @@ unique_ptr<TableFilter> IsNullFilter::Deserialize(Deserializer &deserializer) {
 	return std::move(result);
 }
 
+void JSONPathFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WritePropertyWithDefault<string>(200, "path", path);
+	serializer.WritePropertyWithDefault<unique_ptr<TableFilter>>(201, "child_filter", child_filter);
+}
+
+unique_ptr<TableFilter> JSONPathFilter::Deserialize(Deserializer &deserializer) {
+	auto path = deserializer.ReadPropertyWithDefault<string>(200, "path");
+	auto child_filter = deserializer.ReadPropertyWithDefault<unique_ptr<TableFilter>>(201, "child_filter");
+	auto result = duckdb::unique_ptr<JSONPathFilter>(new JSONPathFilter(std::move(path), std::move(child_filter)));
+	return std::move(result);
+}
+
 void StructFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 	serializer.WritePropertyWithDefault<idx_t>(200, "child_idx", child_idx);
@@ -235,6 +235,8 @@ public:
 
 	// Make the commit persistent
 	void FlushCommit() override;
+	// Write the commit to the WAL without syncing it
+	bool WriteCommit() override;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
@@ -272,6 +274,23 @@ void SingleFileStorageCommitState::FlushCommit() {
 	log = nullptr;
 }
 
+bool SingleFileStorageCommitState::WriteCommit() {
+	bool requires_sync = false;
+	if (log) {
+		if (log->GetTotalWritten() > initial_written) {
+			(void)checkpoint;
+			D_ASSERT(!checkpoint);
+			D_ASSERT(!log->skip_writing);
+			log->WriteFlushMarker();
+			requires_sync = true;
+		}
+		log->skip_writing = false;
+	}
+	// Null so that the destructor will not truncate the log.
+	log = nullptr;
+	return requires_sync;
+}
+
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(Transaction &transaction,
                                                                                bool checkpoint) {
 	return make_uniq<SingleFileStorageCommitState>(*this, checkpoint);
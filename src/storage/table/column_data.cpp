@@ -7,6 +7,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/json_column_data.hpp"
 #include "duckdb/storage/table/list_column_data.hpp"
 #include "duckdb/storage/table/standard_column_data.hpp"
 #include "duckdb/storage/table/array_column_data.hpp"
@@ -311,12 +312,18 @@ bool ColumnData::CheckZonemap(TableFilter &filter) {
 	if (!stats) {
 		throw InternalException("ColumnData::CheckZonemap called on a column without stats");
 	}
-	lock_guard<mutex> l(stats_lock);
-	auto propagate_result = filter.CheckStatistics(stats->statistics);
-	if (propagate_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
-	    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
-		return false;
+	{
+		lock_guard<mutex> l(stats_lock);
+		auto propagate_result = filter.CheckStatistics(stats->statistics);
+		if (propagate_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+			return false;
+		}
 	}
+	return CheckSubColumnZonemap(filter);
+}
+
+bool ColumnData::CheckSubColumnZonemap(TableFilter &filter) {
 	return true;
 }
 
@@ -651,6 +658,8 @@ static RET CreateColumnInternal(BlockManager &block_manager, DataTableInfo &info
 		return OP::template Create<ArrayColumnData>(block_manager, info, column_index, start_row, type, parent);
 	} else if (type.id() == LogicalTypeId::VALIDITY) {
 		return OP::template Create<ValidityColumnData>(block_manager, info, column_index, start_row, *parent);
+	} else if (type.IsJSONType() && !parent) {
+		return OP::template Create<JSONColumnData>(block_manager, info, column_index, start_row, type);
 	}
 	return OP::template Create<StandardColumnData>(block_manager, info, column_index, start_row, type, parent);
 }
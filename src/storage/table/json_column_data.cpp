@@ -0,0 +1,534 @@
+#include "duckdb/storage/table/json_column_data.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/string_type.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/json_path_filter.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+#include "yyjson.hpp"
+
+using namespace duckdb_yyjson; // NOLINT
+
+namespace duckdb {
+
+idx_t ShreddedJSONColumns::FindPath(const string &path) const {
+	for (idx_t i = 0; i < paths.size(); i++) {
+		if (paths[i] == path) {
+			return i;
+		}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+JSONColumnData::JSONColumnData(BlockManager &block_manager, DataTableInfo &info, idx_t column_index, idx_t start_row,
+                               LogicalType type)
+    : StandardColumnData(block_manager, info, column_index, start_row, std::move(type)) {
+}
+
+void JSONColumnData::SetStart(idx_t new_start) {
+	StandardColumnData::SetStart(new_start);
+	if (shredded) {
+		for (auto &column : shredded->columns) {
+			column->SetStart(new_start);
+		}
+	}
+}
+
+bool JSONColumnData::CanUseShreddedPaths(idx_t row_count) {
+	// the shredded paths are only written at checkpoints: rows that were appended or updated since are not covered
+	return shredded && row_count <= shredded->count && !HasUpdates() && !validity.HasUpdates();
+}
+
+idx_t JSONColumnData::Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+                           idx_t target_count) {
+	auto offset_in_row_group = state.row_index - start;
+	auto scan_count = StandardColumnData::Scan(transaction, vector_index, state, result, target_count);
+	if (result.GetVectorType() == VectorType::FLAT_VECTOR && CanUseShreddedPaths(offset_in_row_group + scan_count)) {
+		StringVector::SetAuxiliaryData(result, make_uniq<ShreddedJSONAuxiliaryData>(shredded, result.GetData(),
+		                                                                             offset_in_row_group, scan_count));
+	}
+	return scan_count;
+}
+
+void JSONColumnData::CommitDropColumn() {
+	StandardColumnData::CommitDropColumn();
+	if (shredded) {
+		for (auto &column : shredded->columns) {
+			column->CommitDropColumn();
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Shredding
+//===--------------------------------------------------------------------===//
+struct JSONShreddingCandidate {
+	//! The path, e.g. "$.a.b"
+	string path;
+	//! The keys of the path, e.g. ["a", "b"]
+	vector<string> keys;
+	//! The type of the values of the path
+	LogicalType type;
+	//! Whether all values of the path have the type (or are NULL)
+	bool valid = true;
+	//! The number of non-NULL values
+	idx_t non_null_count = 0;
+	//! The sub-column that the values are written to
+	unique_ptr<StandardColumnData> column;
+	ColumnAppendState append_state;
+};
+
+static bool IsShreddableKey(const char *key, idx_t len) {
+	if (len == 0 || !(StringUtil::CharacterIsAlpha(key[0]) || key[0] == '_')) {
+		return false;
+	}
+	for (idx_t i = 1; i < len; i++) {
+		if (!(StringUtil::CharacterIsAlpha(key[i]) || StringUtil::CharacterIsDigit(key[i]) || key[i] == '_')) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Returns the type a scalar JSON value is shredded as, or INVALID if it cannot be shredded
+static LogicalType GetShreddedType(yyjson_val *val) {
+	switch (yyjson_get_tag(val)) {
+	case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NOESC:
+	case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE:
+		return LogicalType::VARCHAR;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT:
+		return LogicalType::BIGINT;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT:
+		return unsafe_yyjson_get_uint(val) <= uint64_t(NumericLimits<int64_t>::Maximum()) ? LogicalType::BIGINT
+		                                                                                   : LogicalType::INVALID;
+	case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_TRUE:
+	case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_FALSE:
+		return LogicalType::BOOLEAN;
+	default:
+		// doubles are not shredded: their text representation does not round-trip through a DOUBLE column
+		return LogicalType::INVALID;
+	}
+}
+
+static void DiscoverPaths(yyjson_val *obj, const string &prefix, vector<string> &keys,
+                          vector<JSONShreddingCandidate> &candidates, unordered_set<string> &discovered) {
+	size_t idx, max;
+	yyjson_val *key, *val;
+	yyjson_obj_foreach(obj, idx, max, key, val) {
+		if (candidates.size() >= JSONColumnData::MAX_SHREDDING_CANDIDATES) {
+			return;
+		}
+		if (!IsShreddableKey(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key))) {
+			continue;
+		}
+		auto path = prefix + "." + string(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key));
+		keys.emplace_back(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key));
+		if (yyjson_is_obj(val)) {
+			if (keys.size() < JSONColumnData::MAX_SHREDDED_DEPTH) {
+				DiscoverPaths(val, path, keys, candidates, discovered);
+			}
+		} else {
+			auto shredded_type = GetShreddedType(val);
+			if (shredded_type.id() != LogicalTypeId::INVALID && discovered.insert(path).second) {
+				JSONShreddingCandidate candidate;
+				candidate.path = path;
+				candidate.keys = keys;
+				candidate.type = std::move(shredded_type);
+				candidates.push_back(std::move(candidate));
+			}
+		}
+		keys.pop_back();
+	}
+}
+
+static yyjson_val *GetPathValue(yyjson_val *val, const vector<string> &keys) {
+	for (auto &key : keys) {
+		if (!yyjson_is_obj(val)) {
+			return nullptr;
+		}
+		val = yyjson_obj_getn(val, key.c_str(), key.size());
+	}
+	return val;
+}
+
+static void ExtractPathValues(JSONShreddingCandidate &candidate, const vector<yyjson_doc *> &docs, Vector &result) {
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < docs.size(); i++) {
+		auto val = docs[i] ? GetPathValue(yyjson_doc_get_root(docs[i]), candidate.keys) : nullptr;
+		if (!val || yyjson_is_null(val)) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		if (GetShreddedType(val) != candidate.type) {
+			candidate.valid = false;
+			return;
+		}
+		candidate.non_null_count++;
+		switch (candidate.type.id()) {
+		case LogicalTypeId::VARCHAR:
+			FlatVector::GetData<string_t>(result)[i] =
+			    StringVector::AddString(result, unsafe_yyjson_get_str(val), unsafe_yyjson_get_len(val));
+			break;
+		case LogicalTypeId::BIGINT:
+			FlatVector::GetData<int64_t>(result)[i] = yyjson_get_sint(val);
+			break;
+		case LogicalTypeId::BOOLEAN:
+			FlatVector::GetData<bool>(result)[i] = unsafe_yyjson_get_bool(val);
+			break;
+		default:
+			throw InternalException("Unsupported type for JSON shredding");
+		}
+	}
+}
+
+static void FreeDocuments(vector<yyjson_doc *> &docs) {
+	for (auto doc : docs) {
+		yyjson_doc_free(doc);
+	}
+	docs.clear();
+}
+
+shared_ptr<ShreddedJSONColumns> JSONColumnData::ShredColumn() {
+	const idx_t row_count = count;
+	if (row_count == 0) {
+		return nullptr;
+	}
+	ColumnScanState scan_state;
+	scan_state.Initialize(type, nullptr);
+	InitializeScan(scan_state);
+
+	vector<JSONShreddingCandidate> candidates;
+	vector<yyjson_doc *> docs;
+	const auto read_flag = YYJSON_READ_ALLOW_INF_AND_NAN | YYJSON_READ_ALLOW_TRAILING_COMMAS;
+	for (idx_t vector_index = 0; vector_index * STANDARD_VECTOR_SIZE < row_count; vector_index++) {
+		const auto vector_count = GetVectorCount(vector_index);
+		Vector scan_vector(type);
+		ScanCommitted(vector_index, scan_state, scan_vector, true, vector_count);
+
+		// parse the documents of the vector
+		UnifiedVectorFormat format;
+		scan_vector.ToUnifiedFormat(vector_count, format);
+		auto strings = UnifiedVectorFormat::GetData<string_t>(format);
+		for (idx_t i = 0; i < vector_count; i++) {
+			auto idx = format.sel->get_index(i);
+			if (!format.validity.RowIsValid(idx)) {
+				docs.push_back(nullptr);
+				continue;
+			}
+			auto doc = yyjson_read_opts(const_cast<char *>(strings[idx].GetData()), strings[idx].GetSize(), read_flag,
+			                            nullptr, nullptr);
+			if (!doc) {
+				// the shredded values must be identical to what the JSON functions extract: give up on invalid JSON
+				FreeDocuments(docs);
+				return nullptr;
+			}
+			docs.push_back(doc);
+		}
+
+		if (vector_index == 0) {
+			// discover the paths in the first vector
+			unordered_set<string> discovered;
+			vector<string> keys;
+			for (auto doc : docs) {
+				auto root = doc ? yyjson_doc_get_root(doc) : nullptr;
+				if (yyjson_is_obj(root)) {
+					DiscoverPaths(root, "$", keys, candidates, discovered);
+				}
+			}
+			for (auto &candidate : candidates) {
+				candidate.column = make_uniq<StandardColumnData>(block_manager, info, 0, start, candidate.type);
+				candidate.column->InitializeAppend(candidate.append_state);
+			}
+		}
+
+		// extract the values of the paths and append them to the sub-columns
+		bool any_valid = false;
+		for (auto &candidate : candidates) {
+			if (!candidate.valid) {
+				continue;
+			}
+			Vector values(candidate.type, vector_count);
+			ExtractPathValues(candidate, docs, values);
+			if (!candidate.valid) {
+				candidate.column.reset();
+				continue;
+			}
+			candidate.column->Append(candidate.append_state, values, vector_count);
+			any_valid = true;
+		}
+		FreeDocuments(docs);
+		if (!any_valid) {
+			return nullptr;
+		}
+	}
+
+	// only keep the paths that are present in at least half of the rows
+	vector<reference<JSONShreddingCandidate>> selected;
+	for (auto &candidate : candidates) {
+		if (candidate.valid && candidate.non_null_count > 0 && candidate.non_null_count * 2 >= row_count) {
+			selected.push_back(candidate);
+		}
+	}
+	if (selected.empty()) {
+		return nullptr;
+	}
+	std::stable_sort(selected.begin(), selected.end(),
+	                 [](const JSONShreddingCandidate &a, const JSONShreddingCandidate &b) {
+		                 return a.non_null_count > b.non_null_count;
+	                 });
+	auto result = make_shared_ptr<ShreddedJSONColumns>();
+	result->count = row_count;
+	for (idx_t i = 0; i < selected.size() && i < MAX_SHREDDED_PATHS; i++) {
+		auto &candidate = selected[i].get();
+		candidate.column->column_index = result->columns.size() + 1;
+		result->paths.push_back(candidate.path);
+		result->columns.push_back(std::move(candidate.column));
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Checkpoint
+//===--------------------------------------------------------------------===//
+JSONColumnCheckpointState::JSONColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
+                                                     PartialBlockManager &partial_block_manager)
+    : StandardColumnCheckpointState(row_group, column_data, partial_block_manager) {
+}
+
+void JSONColumnCheckpointState::WriteDataPointers(RowGroupWriter &writer, Serializer &serializer) {
+	StandardColumnCheckpointState::WriteDataPointers(writer, serializer);
+	serializer.WritePropertyWithDefault<vector<string>>(102, "shredded_paths", shredded_paths);
+	serializer.WritePropertyWithDefault<vector<LogicalType>>(103, "shredded_types", shredded_types);
+	if (shredded_states.empty()) {
+		return;
+	}
+	serializer.WriteList(104, "shredded_columns", shredded_states.size(), [&](Serializer::List &list, idx_t i) {
+		auto &state = shredded_states[i];
+		list.WriteObject([&](Serializer &object) { state->WriteDataPointers(writer, object); });
+	});
+}
+
+unique_ptr<ColumnCheckpointState> JSONColumnData::CreateCheckpointState(RowGroup &row_group,
+                                                                        PartialBlockManager &partial_block_manager) {
+	return make_uniq<JSONColumnCheckpointState>(row_group, *this, partial_block_manager);
+}
+
+bool JSONColumnData::HasChanges() {
+	if (HasUpdates() || validity.HasUpdates()) {
+		return true;
+	}
+	for (auto &segment : data.Segments()) {
+		if (segment.segment_type == ColumnSegmentType::TRANSIENT) {
+			return true;
+		}
+	}
+	return false;
+}
+
+unique_ptr<ColumnCheckpointState> JSONColumnData::Checkpoint(RowGroup &row_group,
+                                                             ColumnCheckpointInfo &checkpoint_info) {
+	// the column is shredded before it is checkpointed, as checkpointing merges the updates into the column
+	// if the column did not change, the shredded paths of the previous checkpoint are still accurate
+	auto new_shredded = HasChanges() ? ShredColumn() : shredded;
+
+	auto base_state = StandardColumnData::Checkpoint(row_group, checkpoint_info);
+	auto &checkpoint_state = base_state->Cast<JSONColumnCheckpointState>();
+	if (new_shredded) {
+		vector<CompressionType> compression_types(new_shredded->columns.size(), CompressionType::COMPRESSION_AUTO);
+		RowGroupWriteInfo write_info(checkpoint_info.info.manager, compression_types,
+		                             checkpoint_info.info.checkpoint_type);
+		for (idx_t i = 0; i < new_shredded->columns.size(); i++) {
+			auto &column = *new_shredded->columns[i];
+			ColumnCheckpointInfo column_info(write_info, i);
+			checkpoint_state.shredded_paths.push_back(new_shredded->paths[i]);
+			checkpoint_state.shredded_types.push_back(column.type);
+			checkpoint_state.shredded_states.push_back(column.Checkpoint(row_group, column_info));
+		}
+	}
+	if (shredded && shredded != new_shredded) {
+		for (auto &column : shredded->columns) {
+			column->CommitDropColumn();
+		}
+	}
+	shredded = std::move(new_shredded);
+	return base_state;
+}
+
+void JSONColumnData::DeserializeColumn(Deserializer &deserializer, BaseStatistics &target_stats) {
+	StandardColumnData::DeserializeColumn(deserializer, target_stats);
+
+	vector<string> paths;
+	vector<LogicalType> types;
+	deserializer.ReadPropertyWithDefault<vector<string>>(102, "shredded_paths", paths);
+	deserializer.ReadPropertyWithDefault<vector<LogicalType>>(103, "shredded_types", types);
+	if (paths.empty()) {
+		return;
+	}
+	if (paths.size() != types.size()) {
+		throw SerializationException("Mismatch between the shredded paths and types of a JSON column");
+	}
+	auto result = make_shared_ptr<ShreddedJSONColumns>();
+	result->count = count;
+	result->paths = std::move(paths);
+	deserializer.ReadList(104, "shredded_columns", [&](Deserializer::List &list, idx_t i) {
+		auto column = make_uniq<StandardColumnData>(block_manager, info, i + 1, start, types[i]);
+		auto column_stats = BaseStatistics::CreateEmpty(types[i]);
+		list.ReadObject([&](Deserializer &object) { column->DeserializeColumn(object, column_stats); });
+		column->MergeStatistics(column_stats);
+		result->columns.push_back(std::move(column));
+	});
+	if (result->columns.size() != result->paths.size()) {
+		throw SerializationException("Mismatch between the shredded paths and columns of a JSON column");
+	}
+	shredded = std::move(result);
+}
+
+void JSONColumnData::GetColumnSegmentInfo(idx_t row_group_index, vector<idx_t> col_path,
+                                          vector<ColumnSegmentInfo> &result) {
+	StandardColumnData::GetColumnSegmentInfo(row_group_index, col_path, result);
+	if (!shredded) {
+		return;
+	}
+	for (idx_t i = 0; i < shredded->columns.size(); i++) {
+		auto child_path = col_path;
+		child_path.push_back(i + 1);
+		shredded->columns[i]->GetColumnSegmentInfo(row_group_index, std::move(child_path), result);
+	}
+}
+
+void JSONColumnData::Verify(RowGroup &parent) {
+#ifdef DEBUG
+	StandardColumnData::Verify(parent);
+	if (shredded) {
+		D_ASSERT(shredded->paths.size() == shredded->columns.size());
+		for (auto &column : shredded->columns) {
+			D_ASSERT(column->start == start);
+		}
+	}
+#endif
+}
+
+//===--------------------------------------------------------------------===//
+// Filters
+//===--------------------------------------------------------------------===//
+bool JSONColumnData::CheckSubColumnZonemap(TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (!CheckSubColumnZonemap(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::JSON_PATH: {
+		auto &path_filter = filter.Cast<JSONPathFilter>();
+		if (!CanUseShreddedPaths(count)) {
+			return true;
+		}
+		auto path_idx = shredded->FindPath(path_filter.path);
+		if (path_idx == DConstants::INVALID_INDEX ||
+		    path_filter.child_filter->filter_type != TableFilterType::CONSTANT_COMPARISON) {
+			return true;
+		}
+		ColumnData &column = *shredded->columns[path_idx];
+		auto &constant_filter = path_filter.child_filter->Cast<ConstantFilter>();
+		if (constant_filter.constant.type() != column.type) {
+			// the filter compares values of a different type than the path has: the statistics cannot be used
+			return true;
+		}
+		return column.CheckZonemap(*path_filter.child_filter);
+	}
+	default:
+		return true;
+	}
+}
+
+bool JSONColumnData::TryNormalizePath(const string &path, string &result) {
+	vector<string> keys;
+	if (StringUtil::StartsWith(path, "$")) {
+		// $.k1.k2
+		if (path.size() == 1 || path[1] != '.') {
+			return false;
+		}
+		keys = StringUtil::Split(path.substr(2), '.');
+		if (StringUtil::EndsWith(path, ".") || path.find("..") != string::npos) {
+			return false;
+		}
+	} else if (StringUtil::StartsWith(path, "/")) {
+		// /k1/k2 (JSON pointer)
+		if (StringUtil::EndsWith(path, "/") || path.find("//") != string::npos) {
+			return false;
+		}
+		keys = StringUtil::Split(path.substr(1), '/');
+	} else {
+		// a bare key
+		keys.push_back(path);
+	}
+	if (keys.empty() || keys.size() > MAX_SHREDDED_DEPTH) {
+		return false;
+	}
+	result = "$";
+	for (auto &key : keys) {
+		if (!IsShreddableKey(key.c_str(), key.size())) {
+			return false;
+		}
+		result += "." + key;
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Auxiliary Data
+//===--------------------------------------------------------------------===//
+ShreddedJSONAuxiliaryData::ShreddedJSONAuxiliaryData(shared_ptr<ShreddedJSONColumns> columns_p,
+                                                     data_ptr_t vector_data, idx_t offset_in_row_group, idx_t count)
+    : VectorAuxiliaryData(TYPE), columns(std::move(columns_p)), vector_data(vector_data),
+      offset_in_row_group(offset_in_row_group), count(count) {
+}
+
+optional_ptr<ShreddedJSONAuxiliaryData> ShreddedJSONAuxiliaryData::Get(Vector &vector) {
+	if (vector.GetVectorType() != VectorType::FLAT_VECTOR || vector.GetType().InternalType() != PhysicalType::VARCHAR) {
+		return nullptr;
+	}
+	auto auxiliary = vector.GetAuxiliary();
+	if (!auxiliary || !auxiliary->GetAuxiliaryData() || auxiliary->GetAuxiliaryDataType() != TYPE) {
+		return nullptr;
+	}
+	auto &aux_data = auxiliary->GetAuxiliaryData()->Cast<ShreddedJSONAuxiliaryData>();
+	if (aux_data.vector_data != vector.GetData()) {
+		// the auxiliary data was inherited from another vector (e.g. a slice of the scanned vector)
+		return nullptr;
+	}
+	return &aux_data;
+}
+
+bool ShreddedJSONAuxiliaryData::TryScan(const string &path, Vector &result) {
+	D_ASSERT(result.GetType().id() == LogicalTypeId::VARCHAR);
+	auto path_idx = columns->FindPath(path);
+	if (path_idx == DConstants::INVALID_INDEX) {
+		return false;
+	}
+	auto &column = *columns->columns[path_idx];
+	ColumnScanState state;
+	state.Initialize(column.type, nullptr);
+	column.InitializeScanWithOffset(state, column.start + offset_in_row_group);
+	if (column.type.id() == LogicalTypeId::VARCHAR) {
+		column.ScanCount(state, result, count);
+	} else {
+		Vector values(column.type, count);
+		column.ScanCount(state, values, count);
+		VectorOperations::DefaultCast(values, result, count);
+	}
+	return true;
+}
+
+} // namespace duckdb
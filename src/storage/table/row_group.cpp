@@ -13,6 +13,7 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/operator_metrics.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -26,12 +27,13 @@
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), allocation_size(0), is_sorted(false) {
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
-    : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), allocation_size(0) {
+    : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), allocation_size(0),
+      is_sorted(pointer.sorted) {
 	// deserialize the columns
 	if (pointer.data_pointers.size() != collection_p.GetTypes().size()) {
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
@@ -171,11 +173,21 @@ void CollectionScanState::Initialize(const vector<LogicalType> &types) {
 	}
 }
 
+//! Attributes the rows that were skipped because of zonemaps to the operator that the calling thread is executing
+static void AddRowsPruned(idx_t rows_pruned) {
+	auto metrics = OperatorMetrics::Active();
+	if (metrics) {
+		metrics->rows_pruned += rows_pruned;
+	}
+}
+
 bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset) {
 	auto &column_ids = state.GetColumnIds();
 	auto filters = state.GetFilters();
 	if (filters) {
 		if (!CheckZonemap(*filters, column_ids)) {
+			auto row_offset = vector_offset * STANDARD_VECTOR_SIZE;
+			AddRowsPruned(this->count > row_offset ? this->count - row_offset : 0);
 			return false;
 		}
 	}
@@ -208,6 +220,7 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	auto filters = state.GetFilters();
 	if (filters) {
 		if (!CheckZonemap(*filters, column_ids)) {
+			AddRowsPruned(this->count);
 			return false;
 		}
 	}
@@ -279,6 +292,7 @@ unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, con
 			row_group->columns.push_back(cols[i]);
 		}
 	}
+	row_group->is_sorted = is_sorted.load();
 	row_group->Verify();
 	return row_group;
 }
@@ -311,6 +325,7 @@ unique_ptr<RowGroup> RowGroup::AddColumn(RowGroupCollection &new_collection, Col
 	row_group->columns = GetColumns();
 	// now add the new column
 	row_group->columns.push_back(std::move(added_column));
+	row_group->is_sorted = is_sorted.load();
 
 	row_group->Verify();
 	return row_group;
@@ -330,6 +345,7 @@ unique_ptr<RowGroup> RowGroup::RemoveColumn(RowGroupCollection &new_collection,
 			row_group->columns.push_back(cols[i]);
 		}
 	}
+	row_group->is_sorted = is_sorted.load();
 
 	row_group->Verify();
 	return row_group;
@@ -397,6 +413,8 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::DYNAMIC_FILTER:
+	case TableFilterType::JSON_PATH:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -434,6 +452,11 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 				// exceedingly rare
 				return true;
 			}
+			auto target_offset = MinValue<idx_t>(target_vector_index * STANDARD_VECTOR_SIZE, state.max_row_group_row);
+			auto current_offset = state.vector_index * STANDARD_VECTOR_SIZE;
+			if (target_offset > current_offset) {
+				AddRowsPruned(target_offset - current_offset);
+			}
 			while (state.vector_index < target_vector_index) {
 				NextVector(state);
 			}
@@ -698,13 +721,15 @@ void RowGroup::FetchRow(TransactionData transaction, ColumnFetchState &state, co
 void RowGroup::AppendVersionInfo(TransactionData transaction, idx_t count) {
 	idx_t row_group_start = this->count.load();
 	idx_t row_group_end = row_group_start + count;
-	if (row_group_end > Storage::ROW_GROUP_SIZE) {
-		row_group_end = Storage::ROW_GROUP_SIZE;
+	auto row_group_size = GetCollection().GetRowGroupSize();
+	if (row_group_end > row_group_size) {
+		row_group_end = row_group_size;
 	}
 	// create the version_info if it doesn't exist yet
 	auto &vinfo = GetOrCreateVersionInfo();
 	vinfo.AppendVersionInfo(transaction, count, row_group_start, row_group_end);
 	this->count = row_group_end;
+	is_sorted = false;
 }
 
 void RowGroup::CommitAppend(transaction_t commit_id, idx_t row_group_start, idx_t count) {
@@ -766,6 +791,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		}
 		MergeStatistics(column.index, *col_data.GetUpdateStatistics());
 	}
+	is_sorted = false;
 }
 
 void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vector &row_ids,
@@ -779,6 +805,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	auto &col_data = GetColumn(primary_column_idx);
 	col_data.UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *col_data.GetUpdateStatistics());
+	is_sorted = false;
 }
 
 unique_ptr<BaseStatistics> RowGroup::GetStatistics(idx_t column_idx) {
@@ -894,6 +921,7 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		serializer.End();
 	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+	row_group_pointer.sorted = is_sorted;
 	Verify();
 	return row_group_pointer;
 }
@@ -917,6 +945,7 @@ void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
 	serializer.WriteProperty(101, "tuple_count", pointer.tuple_count);
 	serializer.WriteProperty(102, "data_pointers", pointer.data_pointers);
 	serializer.WriteProperty(103, "delete_pointers", pointer.deletes_pointers);
+	serializer.WritePropertyWithDefault<bool>(104, "sorted", pointer.sorted, false);
 }
 
 RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
@@ -925,6 +954,7 @@ RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
 	result.tuple_count = deserializer.ReadProperty<uint64_t>(101, "tuple_count");
 	result.data_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(102, "data_pointers");
 	result.deletes_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(103, "delete_pointers");
+	result.sorted = deserializer.ReadPropertyWithDefault<bool>(104, "sorted", false);
 	return result;
 }
 
@@ -15,6 +15,9 @@
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -55,7 +58,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), row_group_size(info->GetRowGroupSize()), allocation_size(0) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -306,6 +309,47 @@ bool RowGroupCollection::IsEmpty(SegmentLock &l) const {
 	return row_groups->IsEmpty(l);
 }
 
+idx_t RowGroupCollection::GetGloballySortedKeyCount() {
+	if (sort_keys.empty()) {
+		return 0;
+	}
+	// every row group has to be sorted, and the ranges of the first key of consecutive row groups may not overlap
+	// the statistics only allow this to be verified for numeric keys without NULL values
+	auto &key = sort_keys[0];
+	if (!types[key.column.index].IsNumeric()) {
+		return 0;
+	}
+	auto l = row_groups->Lock();
+	bool strict = true;
+	Value previous_min;
+	Value previous_max;
+	for (auto row_group = row_groups->GetRootSegment(l); row_group;
+	     row_group = row_groups->GetNextSegment(l, row_group)) {
+		if (!row_group->IsSorted()) {
+			return 0;
+		}
+		auto stats = row_group->GetStatistics(key.column.index);
+		if (stats->CanHaveNull() || !NumericStats::HasMinMax(*stats)) {
+			return 0;
+		}
+		auto min = NumericStats::Min(*stats);
+		auto max = NumericStats::Max(*stats);
+		if (!previous_min.IsNull()) {
+			auto &boundary_before = key.type == OrderType::ASCENDING ? previous_max : previous_min;
+			auto &boundary_after = key.type == OrderType::ASCENDING ? min : max;
+			if (boundary_before == boundary_after) {
+				// rows with an equal first key are split over two row groups, the later keys may not be ordered
+				strict = false;
+			} else if ((boundary_before < boundary_after) != (key.type == OrderType::ASCENDING)) {
+				return 0;
+			}
+		}
+		previous_min = std::move(min);
+		previous_max = std::move(max);
+	}
+	return strict ? sort_keys.size() : 1;
+}
+
 void RowGroupCollection::InitializeAppend(TransactionData transaction, TableAppendState &state) {
 	state.row_start = UnsafeNumericCast<row_t>(total_rows.load());
 	state.current_row = state.row_start;
@@ -340,7 +384,7 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 		auto current_row_group = state.row_group_append_state.row_group;
 		// check how much we can fit into the current row_group
 		idx_t append_count =
-		    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - state.row_group_append_state.offset_in_row_group);
+		    MinValue<idx_t>(remaining, row_group_size - state.row_group_append_state.offset_in_row_group);
 		if (append_count > 0) {
 			auto previous_allocation_size = current_row_group->GetAllocationSize();
 			current_row_group->Append(state.row_group_append_state, chunk, append_count);
@@ -386,7 +430,7 @@ void RowGroupCollection::FinalizeAppend(TransactionData transaction, TableAppend
 	auto remaining = state.total_append_count;
 	auto row_group = state.start_row_group;
 	while (remaining > 0) {
-		auto append_count = MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - row_group->count);
+		auto append_count = MinValue<idx_t>(remaining, row_group_size - row_group->count);
 		row_group->AppendVersionInfo(transaction, append_count);
 		remaining -= append_count;
 		row_group = row_groups->GetNextSegment(row_group);
@@ -738,6 +782,10 @@ struct VacuumState {
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! The sort orders of the table (if any) - vacuumed row groups are rewritten in this order
+	vector<BoundOrderByNode> orders;
+	//! The columns referenced by the sort orders
+	vector<idx_t> sort_columns;
 };
 
 class VacuumTask : public BaseCheckpointTask {
@@ -754,10 +802,11 @@ public:
 		// create the new set of target row groups (initially empty)
 		vector<unique_ptr<RowGroup>> new_row_groups;
 		vector<idx_t> append_counts;
+		auto row_group_size = collection.GetRowGroupSize();
 		idx_t row_group_rows = merge_rows;
 		idx_t start = row_start;
 		for (idx_t target_idx = 0; target_idx < target_count; target_idx++) {
-			idx_t current_row_group_rows = MinValue<idx_t>(row_group_rows, Storage::ROW_GROUP_SIZE);
+			idx_t current_row_group_rows = MinValue<idx_t>(row_group_rows, row_group_size);
 			auto new_row_group = make_uniq<RowGroup>(collection, start, current_row_group_rows);
 			new_row_group->InitializeEmpty(types);
 			new_row_groups.push_back(std::move(new_row_group));
@@ -780,6 +829,37 @@ public:
 		// fill the new row group with the merged rows
 		TableAppendState append_state;
 		new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+		auto append_rows = [&](DataChunk &chunk) {
+			idx_t remaining = chunk.size();
+			while (remaining > 0) {
+				idx_t append_count = MinValue<idx_t>(remaining, row_group_size - append_counts[current_append_idx]);
+				new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, chunk, append_count);
+				append_counts[current_append_idx] += append_count;
+				remaining -= append_count;
+				const bool row_group_full = append_counts[current_append_idx] == row_group_size;
+				const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
+				if (remaining > 0 || (row_group_full && !last_row_group)) {
+					// move to the next row group
+					current_append_idx++;
+					new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
+					// slice chunk for the next append
+					chunk.Slice(append_count, remaining);
+				}
+			}
+		};
+
+		// if the table has sort keys we sort the merged rows before appending them to the new row groups
+		unique_ptr<GlobalSortState> global_sort;
+		LocalSortState local_sort;
+		DataChunk sort_chunk;
+		if (!vacuum_state.orders.empty()) {
+			RowLayout payload_layout;
+			payload_layout.Initialize(types);
+			auto &buffer_manager = BufferManager::GetBufferManager(collection.GetAttached());
+			global_sort = make_uniq<GlobalSortState>(buffer_manager, vacuum_state.orders, payload_layout);
+			local_sort.Initialize(*global_sort, buffer_manager);
+			sort_chunk.InitializeEmpty(global_sort->sort_layout.logical_types);
+		}
 
 		TableScanState scan_state;
 		scan_state.Initialize(column_ids);
@@ -804,29 +884,40 @@ public:
 				if (scan_chunk.size() == 0) {
 					break;
 				}
-				idx_t remaining = scan_chunk.size();
-				while (remaining > 0) {
-					idx_t append_count =
-					    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
-					new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, scan_chunk,
-					                                           append_count);
-					append_counts[current_append_idx] += append_count;
-					remaining -= append_count;
-					const bool row_group_full = append_counts[current_append_idx] == Storage::ROW_GROUP_SIZE;
-					const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
-					if (remaining > 0 || (row_group_full && !last_row_group)) {
-						// move to the next row group
-						current_append_idx++;
-						new_row_groups[current_append_idx]->InitializeAppend(append_state.row_group_append_state);
-						// slice chunk for the next append
-						scan_chunk.Slice(append_count, remaining);
+				if (global_sort) {
+					for (idx_t k = 0; k < vacuum_state.sort_columns.size(); k++) {
+						sort_chunk.data[k].Reference(scan_chunk.data[vacuum_state.sort_columns[k]]);
 					}
+					sort_chunk.SetCardinality(scan_chunk);
+					local_sort.SinkChunk(sort_chunk, scan_chunk);
+					continue;
 				}
+				append_rows(scan_chunk);
 			}
 			// drop the row group after merging
 			current_row_group.CommitDrop();
 			checkpoint_state.segments[c_idx].node.reset();
 		}
+		if (global_sort && merge_rows > 0) {
+			// sort the merged rows and append them to the new row groups in sorted order
+			global_sort->AddLocalState(local_sort);
+			global_sort->PrepareMergePhase();
+			while (global_sort->sorted_blocks.size() > 1) {
+				global_sort->InitializeMergeRound();
+				MergeSorter merge_sorter(*global_sort, global_sort->buffer_manager);
+				merge_sorter.PerformInMergeRound();
+				global_sort->CompleteMergeRound(false);
+			}
+			PayloadScanner scanner(*global_sort);
+			while (scanner.Remaining()) {
+				scan_chunk.Reset();
+				scanner.Scan(scan_chunk);
+				append_rows(scan_chunk);
+			}
+			for (auto &row_group : new_row_groups) {
+				row_group->SetSorted(true);
+			}
+		}
 		idx_t total_append_count = 0;
 		for (idx_t target_idx = 0; target_idx < target_count; target_idx++) {
 			auto &row_group = new_row_groups[target_idx];
@@ -862,6 +953,12 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	for (auto &sort_key : sort_keys) {
+		auto &type = types[sort_key.column.index];
+		auto expr = make_uniq<BoundReferenceExpression>(type, state.orders.size());
+		state.orders.emplace_back(sort_key.type, sort_key.null_order, std::move(expr));
+		state.sort_columns.push_back(sort_key.column.index);
+	}
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
 	for (auto &entry : segments) {
@@ -905,7 +1002,7 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	// we greedily prefer to merge to the lowest target_count
 	// i.e. we prefer to merge 2 row groups into 1, than 3 row groups into 2
 	for (target_count = 1; target_count <= MAX_MERGE_COUNT; target_count++) {
-		auto total_target_size = target_count * Storage::ROW_GROUP_SIZE;
+		auto total_target_size = target_count * row_group_size;
 		merge_count = 0;
 		merge_rows = 0;
 		for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
@@ -928,7 +1025,14 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		if (state.orders.empty() || checkpoint_state.segments[segment_idx].node->IsSorted()) {
+			return false;
+		}
+		// the table has sort keys but this row group is not sorted yet - rewrite it in sorted order
+		merge_count = 1;
+		target_count = 1;
+		merge_rows = state.row_group_counts[segment_idx];
+		next_idx = segment_idx + 1;
 	}
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
@@ -1046,6 +1150,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	new_types.push_back(new_column.GetType());
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
+	result->sort_keys = sort_keys;
 
 	DataChunk dummy_chunk;
 	Vector default_vector(new_column.GetType());
@@ -1074,6 +1179,11 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
 	result->stats.InitializeRemoveColumn(stats, col_idx);
+	for (auto &sort_key : sort_keys) {
+		D_ASSERT(sort_key.column.index != col_idx);
+		auto column_idx = sort_key.column.index > col_idx ? sort_key.column.index - 1 : sort_key.column.index;
+		result->sort_keys.emplace_back(PhysicalIndex(column_idx), sort_key.type, sort_key.null_order);
+	}
 
 	for (auto &current_row_group : row_groups->Segments()) {
 		auto new_row_group = current_row_group.RemoveColumn(*result, col_idx);
@@ -1092,6 +1202,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
 	result->stats.InitializeAlterType(stats, changed_idx, target_type);
+	result->sort_keys = sort_keys;
 
 	vector<LogicalType> scan_types;
 	for (idx_t i = 0; i < bound_columns.size(); i++) {
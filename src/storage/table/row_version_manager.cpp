@@ -14,7 +14,7 @@ void RowVersionManager::SetStart(idx_t new_start) {
 	lock_guard<mutex> l(version_lock);
 	this->start = new_start;
 	idx_t current_start = start;
-	for (idx_t i = 0; i < Storage::ROW_GROUP_VECTOR_COUNT; i++) {
+	for (idx_t i = 0; i < vector_info.size(); i++) {
 		if (vector_info[i]) {
 			vector_info[i]->start = current_start;
 		}
@@ -25,7 +25,7 @@ void RowVersionManager::SetStart(idx_t new_start) {
 idx_t RowVersionManager::GetCommittedDeletedCount(idx_t count) {
 	lock_guard<mutex> l(version_lock);
 	idx_t deleted_count = 0;
-	for (idx_t r = 0, i = 0; r < count; r += STANDARD_VECTOR_SIZE, i++) {
+	for (idx_t r = 0, i = 0; r < count && i < vector_info.size(); r += STANDARD_VECTOR_SIZE, i++) {
 		if (!vector_info[i]) {
 			continue;
 		}
@@ -39,9 +39,19 @@ idx_t RowVersionManager::GetCommittedDeletedCount(idx_t count) {
 }
 
 optional_ptr<ChunkInfo> RowVersionManager::GetChunkInfo(idx_t vector_idx) {
+	if (vector_idx >= vector_info.size()) {
+		return nullptr;
+	}
 	return vector_info[vector_idx].get();
 }
 
+unique_ptr<ChunkInfo> &RowVersionManager::GetChunkInfoEntry(idx_t vector_idx) {
+	if (vector_idx >= vector_info.size()) {
+		vector_info.resize(vector_idx + 1);
+	}
+	return vector_info[vector_idx];
+}
+
 idx_t RowVersionManager::GetSelVector(TransactionData transaction, idx_t vector_idx, SelectionVector &sel_vector,
                                       idx_t max_count) {
 	lock_guard<mutex> l(version_lock);
@@ -83,23 +93,24 @@ void RowVersionManager::AppendVersionInfo(TransactionData transaction, idx_t cou
 		    vector_idx == start_vector_idx ? row_group_start - start_vector_idx * STANDARD_VECTOR_SIZE : 0;
 		idx_t vector_end =
 		    vector_idx == end_vector_idx ? row_group_end - end_vector_idx * STANDARD_VECTOR_SIZE : STANDARD_VECTOR_SIZE;
+		auto &entry = GetChunkInfoEntry(vector_idx);
 		if (vector_start == 0 && vector_end == STANDARD_VECTOR_SIZE) {
 			// entire vector is encapsulated by append: append a single constant
 			auto constant_info = make_uniq<ChunkConstantInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
 			constant_info->insert_id = transaction.transaction_id;
 			constant_info->delete_id = NOT_DELETED_ID;
-			vector_info[vector_idx] = std::move(constant_info);
+			entry = std::move(constant_info);
 		} else {
 			// part of a vector is encapsulated: append to that part
 			optional_ptr<ChunkVectorInfo> new_info;
-			if (!vector_info[vector_idx]) {
+			if (!entry) {
 				// first time appending to this vector: create new info
 				auto insert_info = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
 				new_info = insert_info.get();
-				vector_info[vector_idx] = std::move(insert_info);
-			} else if (vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO) {
+				entry = std::move(insert_info);
+			} else if (entry->type == ChunkInfoType::VECTOR_INFO) {
 				// use existing vector
-				new_info = &vector_info[vector_idx]->Cast<ChunkVectorInfo>();
+				new_info = &entry->Cast<ChunkVectorInfo>();
 			} else {
 				throw InternalException("Error in RowVersionManager::AppendVersionInfo - expected either a "
 				                        "ChunkVectorInfo or no version info");
@@ -122,7 +133,7 @@ void RowVersionManager::CommitAppend(transaction_t commit_id, idx_t row_group_st
 		idx_t vstart = vector_idx == start_vector_idx ? row_group_start - start_vector_idx * STANDARD_VECTOR_SIZE : 0;
 		idx_t vend =
 		    vector_idx == end_vector_idx ? row_group_end - end_vector_idx * STANDARD_VECTOR_SIZE : STANDARD_VECTOR_SIZE;
-		auto &info = *vector_info[vector_idx];
+		auto &info = *GetChunkInfoEntry(vector_idx);
 		info.CommitAppend(commit_id, vstart, vend);
 	}
 }
@@ -130,27 +141,28 @@ void RowVersionManager::CommitAppend(transaction_t commit_id, idx_t row_group_st
 void RowVersionManager::RevertAppend(idx_t start_row) {
 	lock_guard<mutex> lock(version_lock);
 	idx_t start_vector_idx = (start_row + (STANDARD_VECTOR_SIZE - 1)) / STANDARD_VECTOR_SIZE;
-	for (idx_t vector_idx = start_vector_idx; vector_idx < Storage::ROW_GROUP_VECTOR_COUNT; vector_idx++) {
-		vector_info[vector_idx].reset();
+	if (start_vector_idx < vector_info.size()) {
+		vector_info.resize(start_vector_idx);
 	}
 }
 
 ChunkVectorInfo &RowVersionManager::GetVectorInfo(idx_t vector_idx) {
-	if (!vector_info[vector_idx]) {
+	auto &entry = GetChunkInfoEntry(vector_idx);
+	if (!entry) {
 		// no info yet: create it
-		vector_info[vector_idx] = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
-	} else if (vector_info[vector_idx]->type == ChunkInfoType::CONSTANT_INFO) {
-		auto &constant = vector_info[vector_idx]->Cast<ChunkConstantInfo>();
+		entry = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
+	} else if (entry->type == ChunkInfoType::CONSTANT_INFO) {
+		auto &constant = entry->Cast<ChunkConstantInfo>();
 		// info exists but it's a constant info: convert to a vector info
 		auto new_info = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
 		new_info->insert_id = constant.insert_id;
 		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 			new_info->inserted[i] = constant.insert_id;
 		}
-		vector_info[vector_idx] = std::move(new_info);
+		entry = std::move(new_info);
 	}
-	D_ASSERT(vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO);
-	return vector_info[vector_idx]->Cast<ChunkVectorInfo>();
+	D_ASSERT(entry->type == ChunkInfoType::VECTOR_INFO);
+	return entry->Cast<ChunkVectorInfo>();
 }
 
 idx_t RowVersionManager::DeleteRows(idx_t vector_idx, transaction_t transaction_id, row_t rows[], idx_t count) {
@@ -176,7 +188,7 @@ vector<MetaBlockPointer> RowVersionManager::Checkpoint(MetadataManager &manager)
 	}
 	// first count how many ChunkInfo's we need to deserialize
 	vector<pair<idx_t, reference<ChunkInfo>>> to_serialize;
-	for (idx_t vector_idx = 0; vector_idx < Storage::ROW_GROUP_VECTOR_COUNT; vector_idx++) {
+	for (idx_t vector_idx = 0; vector_idx < vector_info.size(); vector_idx++) {
 		auto chunk_info = vector_info[vector_idx].get();
 		if (!chunk_info) {
 			continue;
@@ -218,11 +230,11 @@ shared_ptr<RowVersionManager> RowVersionManager::Deserialize(MetaBlockPointer de
 	D_ASSERT(chunk_count > 0);
 	for (idx_t i = 0; i < chunk_count; i++) {
 		idx_t vector_index = source.Read<idx_t>();
-		if (vector_index >= Storage::ROW_GROUP_VECTOR_COUNT) {
+		if (vector_index >= Storage::MAX_ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE) {
 			throw InternalException(
 			    "In DeserializeDeletes, vector_index is out of range for the row group. Corrupted file?");
 		}
-		version_info->vector_info[vector_index] = ChunkInfo::Read(source);
+		version_info->GetChunkInfoEntry(vector_index) = ChunkInfo::Read(source);
 	}
 	version_info->has_changes = false;
 	return version_info;
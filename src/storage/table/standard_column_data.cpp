@@ -178,26 +178,21 @@ void StandardColumnData::CommitDropColumn() {
 	validity.CommitDropColumn();
 }
 
-struct StandardColumnCheckpointState : public ColumnCheckpointState {
-	StandardColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
-	                              PartialBlockManager &partial_block_manager)
-	    : ColumnCheckpointState(row_group, column_data, partial_block_manager) {
-	}
-
-	unique_ptr<ColumnCheckpointState> validity_state;
+StandardColumnCheckpointState::StandardColumnCheckpointState(RowGroup &row_group, ColumnData &column_data,
+                                                             PartialBlockManager &partial_block_manager)
+    : ColumnCheckpointState(row_group, column_data, partial_block_manager) {
+}
 
-public:
-	unique_ptr<BaseStatistics> GetStatistics() override {
-		D_ASSERT(global_stats);
-		return std::move(global_stats);
-	}
+unique_ptr<BaseStatistics> StandardColumnCheckpointState::GetStatistics() {
+	D_ASSERT(global_stats);
+	return std::move(global_stats);
+}
 
-	void WriteDataPointers(RowGroupWriter &writer, Serializer &serializer) override {
-		ColumnCheckpointState::WriteDataPointers(writer, serializer);
-		serializer.WriteObject(101, "validity",
-		                       [&](Serializer &serializer) { validity_state->WriteDataPointers(writer, serializer); });
-	}
-};
+void StandardColumnCheckpointState::WriteDataPointers(RowGroupWriter &writer, Serializer &serializer) {
+	ColumnCheckpointState::WriteDataPointers(writer, serializer);
+	serializer.WriteObject(101, "validity",
+	                       [&](Serializer &serializer) { validity_state->WriteDataPointers(writer, serializer); });
+}
 
 unique_ptr<ColumnCheckpointState>
 StandardColumnData::CreateCheckpointState(RowGroup &row_group, PartialBlockManager &partial_block_manager) {
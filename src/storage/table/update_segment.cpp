@@ -163,14 +163,14 @@ void UpdateSegment::FetchUpdates(TransactionData transaction, idx_t vector_index
 	if (!root) {
 		return;
 	}
-	if (!root->info[vector_index]) {
+	auto node = root->GetVectorData(vector_index);
+	if (!node) {
 		return;
 	}
 	// FIXME: normalify if this is not the case... need to pass in count?
 	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	fetch_update_function(transaction.start_time, transaction.transaction_id, root->info[vector_index]->info.get(),
-	                      result);
+	fetch_update_function(transaction.start_time, transaction.transaction_id, node->info.get(), result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -231,13 +231,14 @@ void UpdateSegment::FetchCommitted(idx_t vector_index, Vector &result) {
 	if (!root) {
 		return;
 	}
-	if (!root->info[vector_index]) {
+	auto node = root->GetVectorData(vector_index);
+	if (!node) {
 		return;
 	}
 	// FIXME: normalify if this is not the case... need to pass in count?
 	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
 
-	fetch_committed_function(root->info[vector_index]->info.get(), result);
+	fetch_committed_function(node->info.get(), result);
 }
 
 //===--------------------------------------------------------------------===//
@@ -325,6 +326,7 @@ static UpdateSegment::fetch_committed_range_function_t GetFetchCommittedRangeFun
 
 void UpdateSegment::FetchCommittedRange(idx_t start_row, idx_t count, Vector &result) {
 	D_ASSERT(count > 0);
+	auto lock_handle = lock.GetSharedLock();
 	if (!root) {
 		return;
 	}
@@ -334,10 +336,10 @@ void UpdateSegment::FetchCommittedRange(idx_t start_row, idx_t count, Vector &re
 	idx_t start_vector = start_row / STANDARD_VECTOR_SIZE;
 	idx_t end_vector = (end_row - 1) / STANDARD_VECTOR_SIZE;
 	D_ASSERT(start_vector <= end_vector);
-	D_ASSERT(end_vector < Storage::ROW_GROUP_VECTOR_COUNT);
 
 	for (idx_t vector_idx = start_vector; vector_idx <= end_vector; vector_idx++) {
-		if (!root->info[vector_idx]) {
+		auto node = root->GetVectorData(vector_idx);
+		if (!node) {
 			continue;
 		}
 		idx_t start_in_vector = vector_idx == start_vector ? start_row - start_vector * STANDARD_VECTOR_SIZE : 0;
@@ -346,8 +348,7 @@ void UpdateSegment::FetchCommittedRange(idx_t start_row, idx_t count, Vector &re
 		D_ASSERT(start_in_vector < end_in_vector);
 		D_ASSERT(end_in_vector > 0 && end_in_vector <= STANDARD_VECTOR_SIZE);
 		idx_t result_offset = ((vector_idx * STANDARD_VECTOR_SIZE) + start_in_vector) - start_row;
-		fetch_committed_range(root->info[vector_idx]->info.get(), start_in_vector, end_in_vector, result_offset,
-		                      result);
+		fetch_committed_range(node->info.get(), start_in_vector, end_in_vector, result_offset, result);
 	}
 }
 
@@ -432,12 +433,13 @@ void UpdateSegment::FetchRow(TransactionData transaction, idx_t row_id, Vector &
 		return;
 	}
 	idx_t vector_index = (row_id - column_data.start) / STANDARD_VECTOR_SIZE;
-	if (!root->info[vector_index]) {
+	auto node = root->GetVectorData(vector_index);
+	if (!node) {
 		return;
 	}
 	idx_t row_in_vector = (row_id - column_data.start) - vector_index * STANDARD_VECTOR_SIZE;
-	fetch_row_function(transaction.start_time, transaction.transaction_id, root->info[vector_index]->info.get(),
-	                   row_in_vector, result, result_idx);
+	fetch_row_function(transaction.start_time, transaction.transaction_id, node->info.get(), row_in_vector, result,
+	                   result_idx);
 }
 
 //===--------------------------------------------------------------------===//
@@ -501,10 +503,11 @@ void UpdateSegment::RollbackUpdate(UpdateInfo &info) {
 	auto lock_handle = lock.GetExclusiveLock();
 
 	// move the data from the UpdateInfo back into the base info
-	if (!root->info[info.vector_index]) {
+	auto node = root->GetVectorData(info.vector_index);
+	if (!node) {
 		return;
 	}
-	rollback_update_function(*root->info[info.vector_index]->info, info);
+	rollback_update_function(*node->info, info);
 
 	// clean up the update chain
 	CleanupUpdateInternal(*lock_handle, info);
@@ -1107,7 +1110,9 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 	idx_t vector_offset = column_data.start + vector_index * STANDARD_VECTOR_SIZE;
 
 	D_ASSERT(idx_t(first_id) >= column_data.start);
-	D_ASSERT(vector_index < Storage::ROW_GROUP_VECTOR_COUNT);
+	if (vector_index >= root->info.size()) {
+		root->info.resize(vector_index + 1);
+	}
 
 	// first check the version chain
 	UpdateInfo *node = nullptr;
@@ -1206,7 +1211,7 @@ bool UpdateSegment::HasUpdates(idx_t vector_index) const {
 	if (!HasUpdates()) {
 		return false;
 	}
-	return root->info[vector_index].get();
+	return root->GetVectorData(vector_index) != nullptr;
 }
 
 bool UpdateSegment::HasUncommittedUpdates(idx_t vector_index) {
@@ -1229,7 +1234,7 @@ bool UpdateSegment::HasUpdates(idx_t start_row_index, idx_t end_row_index) {
 	idx_t base_vector_index = start_row_index / STANDARD_VECTOR_SIZE;
 	idx_t end_vector_index = end_row_index / STANDARD_VECTOR_SIZE;
 	for (idx_t i = base_vector_index; i <= end_vector_index; i++) {
-		if (root->info[i]) {
+		if (root->GetVectorData(i)) {
 			return true;
 		}
 	}
@@ -401,6 +401,16 @@ void WriteAheadLog::WriteAlter(const AlterInfo &info) {
 // FLUSH
 //===--------------------------------------------------------------------===//
 void WriteAheadLog::Flush() {
+	if (skip_writing) {
+		return;
+	}
+	WriteFlushMarker();
+
+	// flushes all changes made to the WAL to disk
+	writer->Sync();
+}
+
+void WriteAheadLog::WriteFlushMarker() {
 	if (skip_writing) {
 		return;
 	}
@@ -409,9 +419,6 @@ void WriteAheadLog::Flush() {
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
-
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
 }
 
 } // namespace duckdb
@@ -169,7 +169,8 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
 	//    true: Then this function will NOT write to the WAL or flush/persist.
 	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
-	//    false: Then this function WILL write to the WAL and Flush/Persist it.
+	//    false: Then this function WILL write to the WAL. Syncing it to disk is left to the caller if
+	//           requires_wal_sync is set afterwards, so that the commits of concurrent transactions share a sync.
 	this->commit_id = new_commit_id;
 	if (!ChangesMade()) {
 		// no need to flush anything if we made no changes
@@ -192,7 +193,7 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		storage->Commit(commit_state, *this);
 		undo_buffer.Commit(iterator_state, log, commit_id);
 		if (storage_commit_state) {
-			storage_commit_state->FlushCommit();
+			requires_wal_sync = storage_commit_state->WriteCommit();
 		}
 		return ErrorData();
 	} catch (std::exception &ex) {
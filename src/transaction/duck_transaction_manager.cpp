@@ -233,10 +233,25 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		lock.reset();
 	}
 
+	// the commit has been written to the WAL but not synced yet: that happens after releasing the transaction lock
+	idx_t wal_commit_count = 0;
+	unique_ptr<StorageLockKey> wal_lock;
+	if (!error.HasError() && transaction.requires_wal_sync) {
+		D_ASSERT(!checkpoint_decision.can_checkpoint);
+		wal_commit_count = ++wal_commits_written;
+		// keep a checkpoint from removing the WAL until it has been synced
+		wal_lock = SharedCheckpointLock();
+	}
+
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
 	RemoveTransaction(transaction, store_transaction);
+	if (wal_commit_count > 0) {
+		// wait for the commit to become durable
+		tlock.unlock();
+		SyncWAL(wal_commit_count);
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
@@ -253,6 +268,52 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	return error;
 }
 
+void DuckTransactionManager::SyncWAL(idx_t commit_count) {
+	unique_lock<mutex> sync_guard(wal_sync_lock);
+	while (wal_commits_synced < commit_count) {
+		if (wal_sync_active) {
+			// another thread is syncing the WAL - wait for it and check if it covered our commit
+			wal_sync_done.wait(sync_guard);
+			continue;
+		}
+		// sync the WAL on behalf of all commits that have been written to it so far
+		wal_sync_active = true;
+		sync_guard.unlock();
+
+		idx_t synced_count;
+		ErrorData error;
+		try {
+			optional_ptr<WriteAheadLog> wal;
+			{
+				// write out the buffered entries - this has to wait for any commit that is writing to the WAL
+				lock_guard<mutex> tlock(transaction_lock);
+				synced_count = wal_commits_written;
+				wal = db.GetStorageManager().GetWAL();
+				if (wal && wal->Initialized()) {
+					wal->GetWriter().Flush();
+				}
+			}
+			// the slow part - new commits can be written to the WAL in the meantime
+			if (wal && wal->Initialized()) {
+				wal->GetWriter().handle->Sync();
+			}
+		} catch (std::exception &ex) {
+			error = ErrorData(ex);
+		}
+
+		sync_guard.lock();
+		wal_sync_active = false;
+		if (!error.HasError()) {
+			wal_commits_synced = MaxValue(wal_commits_synced, synced_count);
+		}
+		wal_sync_done.notify_all();
+		if (error.HasError()) {
+			// the transactions have already been committed in memory, so we cannot roll back
+			throw FatalException("Failed to sync the write-ahead log: %s", error.RawMessage());
+		}
+	}
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
@@ -77,6 +77,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 #endif
 	    {"enable_fsst_vectors", {true}},
 	    {"enable_object_cache", {true}},
+	    {"enable_hardware_counters", {true}},
 	    {"enable_profiling", {"json"}},
 	    {"enable_progress_bar", {true}},
 	    {"errors_as_json", {true}},
@@ -94,6 +95,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"memory_limit", {"4.0 GiB"}},
 	    {"storage_compatibility_version", {"v0.10.0"}},
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
+	    {"quantile_sort_threshold", {Value::UBIGINT(1000)}},
 	    {"null_order", {"nulls_first"}},
 	    {"perfect_ht_threshold", {0}},
 	    {"pivot_filter_threshold", {999}},
@@ -114,6 +116,7 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"arrow_large_buffer_size", {true}},
 	    {"enable_http_logging", {true}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
+	    {"trace_output", {"my_trace_file.json"}},
 	};
 	// Every option that's not excluded has to be part of this map
 	if (!value_map.count(name)) {
@@ -116,3 +116,61 @@ TEST_CASE("absolute paths", "[file_system]") {
 	REQUIRE(fs.NormalizeAbsolutePath(long_path) == "\\\\?\\d:\\very long network\\");
 #endif
 }
+
+static void ConcatenateFiles(FileSystem &fs, const duckdb::vector<string> &sources, const string &target) {
+	auto target_handle =
+	    fs.OpenFile(target, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	for (auto &source : sources) {
+		auto source_handle = fs.OpenFile(source, FileFlags::FILE_FLAGS_READ);
+		auto size = source_handle->GetFileSize();
+		auto data = make_unsafe_uniq_array<data_t>(size);
+		source_handle->Read(data.get(), size);
+		target_handle->Write(data.get(), size);
+	}
+	target_handle->Sync();
+}
+
+TEST_CASE("Test parallel decompression of gzip files", "[file_system]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	auto fs = FileSystem::CreateLocal();
+
+	// a file of concatenated gzip members: the members are decompressed in parallel
+	// the data does not compress well, so that the file is split into several units
+	duckdb::vector<string> members;
+	for (idx_t i = 0; i < 3; i++) {
+		members.push_back(TestCreatePath("member_" + to_string(i) + ".csv.gz"));
+		REQUIRE_NO_FAIL(con.Query("COPY (SELECT " + to_string(i) +
+		                          " * 100000 + i AS i, md5(i::VARCHAR) || md5((i + 1)::VARCHAR) AS s FROM range(100000) "
+		                          "r(i)) TO '" +
+		                          members.back() + "' (HEADER false)"));
+	}
+	auto concatenated = TestCreatePath("concatenated.csv.gz");
+	ConcatenateFiles(*fs, members, concatenated);
+
+	auto result = con.Query("SELECT count(*), sum(i), count(DISTINCT s) FROM read_csv('" + concatenated +
+	                        "', columns={'i': 'BIGINT', 's': 'VARCHAR'})");
+	REQUIRE(CHECK_COLUMN(result, 0, {300000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(44999850000)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {100000}));
+
+	// a single member that is too large to find its end: the file is decompressed sequentially
+	auto single_member = TestCreatePath("single_member.csv.gz");
+	REQUIRE_NO_FAIL(con.Query("COPY (SELECT i, md5(i::VARCHAR) || md5((i + 1)::VARCHAR) AS s FROM range(600000) r(i)) TO "
+	                          "'" +
+	                          single_member + "' (HEADER false)"));
+	result = con.Query("SELECT count(*), sum(i), count(DISTINCT s) FROM read_csv('" + single_member +
+	                   "', columns={'i': 'BIGINT', 's': 'VARCHAR'})");
+	REQUIRE(CHECK_COLUMN(result, 0, {600000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(179999700000)}));
+	REQUIRE(CHECK_COLUMN(result, 2, {600000}));
+
+	// a multi-member file that ends in a single large member: the last member is decompressed sequentially
+	members.push_back(single_member);
+	auto mixed = TestCreatePath("mixed.csv.gz");
+	ConcatenateFiles(*fs, members, mixed);
+	result = con.Query("SELECT count(*), sum(i) FROM read_csv('" + mixed + "', columns={'i': 'BIGINT', 's': 'VARCHAR'})");
+	REQUIRE(CHECK_COLUMN(result, 0, {900000}));
+	REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(224999550000)}));
+}
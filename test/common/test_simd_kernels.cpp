@@ -0,0 +1,140 @@
+#include "catch.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/simd/simd_kernels.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+#include <cmath>
+#include <limits>
+
+using namespace duckdb;
+
+static const SIMDComparison COMPARISONS[] = {SIMDComparison::EQUAL,
+                                             SIMDComparison::NOT_EQUAL,
+                                             SIMDComparison::LESS_THAN,
+                                             SIMDComparison::LESS_THAN_EQUALS,
+                                             SIMDComparison::GREATER_THAN,
+                                             SIMDComparison::GREATER_THAN_EQUALS};
+
+// the counts exercise the vector loops as well as the remaining rows that do not fill an entire register
+static const idx_t COUNTS[] = {0, 1, 3, 7, 8, 15, 16, 17, 33, 100, 1023, 2048};
+
+template <class T>
+static void TestSelectKernel(simd_select_kernel_t<T> kernel, simd_select_kernel_t<T> reference, const vector<T> &data,
+                             const vector<T> &constants) {
+	vector<sel_t> true_sel(data.size());
+	vector<sel_t> false_sel(data.size());
+	vector<sel_t> expected_true_sel(data.size());
+	vector<sel_t> expected_false_sel(data.size());
+	for (auto count : COUNTS) {
+		for (auto constant : constants) {
+			for (auto comparison : COMPARISONS) {
+				auto expected = reference(data.data(), constant, comparison, count, expected_true_sel.data(),
+				                          expected_false_sel.data());
+				auto result = kernel(data.data(), constant, comparison, count, true_sel.data(), false_sel.data());
+				REQUIRE(result == expected);
+				for (idx_t i = 0; i < result; i++) {
+					REQUIRE(true_sel[i] == expected_true_sel[i]);
+				}
+				for (idx_t i = 0; i < count - result; i++) {
+					REQUIRE(false_sel[i] == expected_false_sel[i]);
+				}
+				// either selection can be omitted
+				REQUIRE(kernel(data.data(), constant, comparison, count, true_sel.data(), nullptr) == expected);
+				REQUIRE(kernel(data.data(), constant, comparison, count, nullptr, false_sel.data()) == expected);
+				for (idx_t i = 0; i < count - result; i++) {
+					REQUIRE(false_sel[i] == expected_false_sel[i]);
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("Test that the SIMD kernels match the scalar kernels", "[simd]") {
+	const idx_t max_count = 2048;
+	RandomEngine random(42);
+
+	vector<uint64_t> data64(max_count);
+	vector<uint32_t> data32(max_count);
+	vector<int32_t> int32_data(max_count);
+	vector<int64_t> int64_data(max_count);
+	vector<float> float_data(max_count);
+	vector<double> double_data(max_count);
+	for (idx_t i = 0; i < max_count; i++) {
+		auto value = random.NextRandomInteger();
+		data64[i] = uint64_t(value) << 32 | random.NextRandomInteger();
+		data32[i] = value;
+		// few distinct values, so that every comparison has matches and non-matches
+		int32_data[i] = int32_t(value % 21) - 10;
+		int64_data[i] = (int64_t(value % 21) - 10) * 1000000000000LL;
+		float_data[i] = float(int32_data[i]) / 4;
+		double_data[i] = double(int32_data[i]) / 4;
+		if (i % 13 == 0) {
+			float_data[i] = std::numeric_limits<float>::quiet_NaN();
+			double_data[i] = std::numeric_limits<double>::quiet_NaN();
+		} else if (i % 17 == 0) {
+			float_data[i] = -0.0f;
+			double_data[i] = -0.0;
+		}
+	}
+	const vector<int32_t> int32_constants {-11, -10, 0, 3, 10, NumericLimits<int32_t>::Minimum()};
+	const vector<int64_t> int64_constants {-10000000000000LL, 0, 3000000000000LL, NumericLimits<int64_t>::Maximum()};
+	const vector<float> float_constants {-3.0f, 0.0f, -0.0f, 0.75f, std::numeric_limits<float>::infinity()};
+	const vector<double> double_constants {-3.0, 0.0, -0.0, 0.75, -std::numeric_limits<double>::infinity()};
+
+	// bytes from a small alphabet, so that every block contains matches and non-matches
+	const char ALPHABET[] = {'a', ',', '\n', '\r', '"', '\\', '\0', char(0xFF)};
+	vector<data_t> bytes(SIMDKernels::MATCH_BLOCK_SIZE * 4);
+	for (auto &byte : bytes) {
+		byte = data_t(ALPHABET[random.NextRandomInteger() % sizeof(ALPHABET)]);
+	}
+
+	auto scalar = SIMDKernels::GetKernels(SIMDLevel::SCALAR);
+	for (auto level : SIMDKernels::SupportedLevels()) {
+		auto kernels = SIMDKernels::GetKernels(level);
+		REQUIRE(kernels.level == level);
+
+		// hashing
+		vector<hash_t> result(max_count);
+		vector<hash_t> expected(max_count);
+		for (auto count : COUNTS) {
+			kernels.hash_uint64(data64.data(), result.data(), count);
+			for (idx_t i = 0; i < count; i++) {
+				REQUIRE(result[i] == Hash<uint64_t>(data64[i]));
+			}
+			kernels.hash_uint32(data32.data(), result.data(), count);
+			for (idx_t i = 0; i < count; i++) {
+				REQUIRE(result[i] == Hash<uint32_t>(data32[i]));
+			}
+
+			for (idx_t i = 0; i < count; i++) {
+				result[i] = expected[i] = data64[max_count - i - 1];
+			}
+			kernels.combine_hash_uint64(data64.data(), result.data(), count);
+			scalar.combine_hash_uint64(data64.data(), expected.data(), count);
+			kernels.combine_hash_uint32(data32.data(), result.data(), count);
+			scalar.combine_hash_uint32(data32.data(), expected.data(), count);
+			for (idx_t i = 0; i < count; i++) {
+				REQUIRE(result[i] == expected[i]);
+			}
+		}
+
+		// selection
+		TestSelectKernel<int32_t>(kernels.select_int32, scalar.select_int32, int32_data, int32_constants);
+		TestSelectKernel<int64_t>(kernels.select_int64, scalar.select_int64, int64_data, int64_constants);
+		TestSelectKernel<float>(kernels.select_float, scalar.select_float, float_data, float_constants);
+		TestSelectKernel<double>(kernels.select_double, scalar.select_double, double_data, double_constants);
+
+		// bit counting
+		for (idx_t entry_count = 0; entry_count < 40; entry_count++) {
+			REQUIRE(kernels.count_bits(data64.data(), entry_count) == scalar.count_bits(data64.data(), entry_count));
+		}
+
+		// byte matching, at unaligned offsets as well
+		for (idx_t offset = 0; offset + SIMDKernels::MATCH_BLOCK_SIZE <= bytes.size(); offset += 7) {
+			auto data = bytes.data() + offset;
+			REQUIRE(kernels.match_bytes(data, ',', '\n', '\r') == scalar.match_bytes(data, ',', '\n', '\r'));
+			REQUIRE(kernels.match_bytes(data, '"', '\\', '"') == scalar.match_bytes(data, '"', '\\', '"'));
+			REQUIRE(kernels.match_bytes(data, '\0', 0xFF, 'z') == scalar.match_bytes(data, '\0', 0xFF, 'z'));
+		}
+	}
+}